@@ -0,0 +1,219 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Batched bindings of UBenchObject as FSkookumScriptGenerator emits them with
+// GenerateBatchBindings=True (generate_batch_method() and generate_batch_property_accessor()),
+// which the offline generator does not support - keep in sync with those templates.
+// Real is the unaligned case, Vector3 and Transform go through SkUEBatch::tAlignedArray.
+//=======================================================================================
+
+#include "SkUEBatch.generated.hpp"
+
+namespace SkUEBenchObject_BatchImpl
+  {
+
+  static void mthdc_echo_real_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    TArray<float> args_Value;
+    SkUEBatch::unpack<SkReal>(scope_p, SkArg_2, count, &args_Value);
+    TArray<float> results;
+    results.Reserve(count);
+    struct FDispatchParams
+      {
+      float Value;
+      float ReturnValue;
+      } params;
+    static UFunction * function_p = SkUEBenchObject::ms_uclass_p->GetDefaultObject()->FindFunctionChecked(FName(TEXT("EchoReal")));
+    check(function_p->ParmsSize <= sizeof(FDispatchParams));
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      params.Value = args_Value[i];
+      params.ReturnValue = float(0.0f);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@echo_real_batch but one of the receivers is null.");
+      if (this_p)
+        {
+        this_p->ProcessEvent(function_p, &params);
+        results.Add(params.ReturnValue);
+        }
+      else
+        {
+        results.Add(float(0.0f));
+        }
+      }
+    if (result_pp) *result_pp = SkUEBatch::pack<SkReal>(results);
+    }
+
+  static void mthdc_echo_vector_3_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    SkUEBatch::tAlignedArray<FVector> args_Value;
+    SkUEBatch::unpack<SkVector3>(scope_p, SkArg_2, count, &args_Value);
+    SkUEBatch::tAlignedArray<FVector> results;
+    results.Reserve(count);
+    struct FDispatchParams
+      {
+      FVector Value;
+      FVector ReturnValue;
+      } params;
+    static UFunction * function_p = SkUEBenchObject::ms_uclass_p->GetDefaultObject()->FindFunctionChecked(FName(TEXT("EchoVector3")));
+    check(function_p->ParmsSize <= sizeof(FDispatchParams));
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      params.Value = args_Value[i];
+      params.ReturnValue = FVector(ForceInitToZero);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@echo_vector_3_batch but one of the receivers is null.");
+      if (this_p)
+        {
+        this_p->ProcessEvent(function_p, &params);
+        results.Add(params.ReturnValue);
+        }
+      else
+        {
+        results.Add(FVector(ForceInitToZero));
+        }
+      }
+    if (result_pp) *result_pp = SkUEBatch::pack<SkVector3>(results);
+    }
+
+  static void mthdc_real_value_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("RealValue"));
+    TArray<float> results;
+    results.Reserve(count);
+    const float default_value(0.0f);
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@real_value_batch but one of the receivers is null.");
+      int32 result_index = results.Add(default_value);
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(&results[result_index], property_p->ContainerPtrToValuePtr<void>(this_p));
+        }
+      }
+    if (result_pp) *result_pp = SkUEBatch::pack<SkReal>(results);
+    }
+
+  static void mthdc_real_value_set_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("RealValue"));
+    TArray<float> values;
+    SkUEBatch::unpack<SkReal>(scope_p, SkArg_2, count, &values);
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@real_value_set_batch but one of the receivers is null.");
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &values[i]);
+        }
+      }
+    }
+
+  static void mthdc_vector_3value_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("Vector3Value"));
+    SkUEBatch::tAlignedArray<FVector> results;
+    results.Reserve(count);
+    const FVector default_value(ForceInitToZero);
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@vector_3value_batch but one of the receivers is null.");
+      int32 result_index = results.Add(default_value);
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(&results[result_index], property_p->ContainerPtrToValuePtr<void>(this_p));
+        }
+      }
+    if (result_pp) *result_pp = SkUEBatch::pack<SkVector3>(results);
+    }
+
+  static void mthdc_vector_3value_set_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("Vector3Value"));
+    SkUEBatch::tAlignedArray<FVector> values;
+    SkUEBatch::unpack<SkVector3>(scope_p, SkArg_2, count, &values);
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@vector_3value_set_batch but one of the receivers is null.");
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &values[i]);
+        }
+      }
+    }
+
+  static void mthdc_transform_value_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("TransformValue"));
+    SkUEBatch::tAlignedArray<FTransform> results;
+    results.Reserve(count);
+    const FTransform default_value;
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@transform_value_batch but one of the receivers is null.");
+      int32 result_index = results.Add(default_value);
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(&results[result_index], property_p->ContainerPtrToValuePtr<void>(this_p));
+        }
+      }
+    if (result_pp) *result_pp = SkUEBatch::pack<SkTransform>(results);
+    }
+
+  static void mthdc_transform_value_set_batch(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();
+    const uint32 count = receivers.get_length();
+    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUEBenchObject::ms_uclass_p, TEXT("TransformValue"));
+    SkUEBatch::tAlignedArray<FTransform> values;
+    SkUEBatch::unpack<SkTransform>(scope_p, SkArg_2, count, &values);
+    for (uint32 i = 0; i < count; ++i)
+      {
+      UBenchObject * this_p = SkMarshal<SkUEBenchObject>::from_instance(receivers.get_array()[i]);
+      SK_ASSERTX(this_p, "Tried to invoke method BenchObject@transform_value_set_batch but one of the receivers is null.");
+      if (this_p)
+        {
+        property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &values[i]);
+        }
+      }
+    }
+
+  static const SkClass::MethodInitializerFuncId methods_c[] =
+    {
+      { 0xc44889c4, mthdc_echo_real_batch },
+      { 0x428fe58e, mthdc_echo_vector_3_batch },
+      { 0x629a88d3, mthdc_real_value_batch },
+      { 0x09b3e7ec, mthdc_real_value_set_batch },
+      { 0x2bd3a8dc, mthdc_vector_3value_batch },
+      { 0x4726bc22, mthdc_vector_3value_set_batch },
+      { 0x17e7cfb0, mthdc_transform_value_batch },
+      { 0xef0ba64c, mthdc_transform_value_set_batch },
+    };
+
+  // The plugin lists these in the class method table of the class - registering them separately has the same effect
+  void register_bindings()
+    {
+    SkUEBenchObject::ms_class_p->register_method_func_bulk(methods_c, 8, SkBindFlag_class_no_rebind);
+    }
+
+  } // SkUEBenchObject_BatchImpl
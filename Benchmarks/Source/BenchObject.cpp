@@ -0,0 +1,81 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Reflection data of UBenchObject, as UHT would register it
+//=======================================================================================
+
+#include "BenchObject.h"
+
+namespace
+  {
+
+  // Parameter block of the echo functions - same layout as the FDispatchParams generated for them
+  template<typename _ValueType>
+  struct FEchoParms
+    {
+    _ValueType Value;
+    _ValueType ReturnValue;
+    };
+
+  template<typename _ValueType>
+  void exec_echo(UObject * /* context_p */, void * parms_p)
+    {
+    FEchoParms<_ValueType> * echo_parms_p = static_cast<FEchoParms<_ValueType> *>(parms_p);
+    echo_parms_p->ReturnValue = echo_parms_p->Value;
+    }
+
+  // Registers property <property_name_p> and functions Echo<function_suffix_p> and StaticEcho<function_suffix_p>
+  template<typename _ValueType>
+  void add_shape(UClass * class_p, UBenchObject * default_object_p, _ValueType UBenchObject::* member_p, const TCHAR * property_name_p, const TCHAR * function_suffix_p)
+    {
+    UProperty * property_p = new UProperty;
+    property_p->m_name = FName(property_name_p);
+    property_p->m_offset = int32(reinterpret_cast<uint8 *>(&(default_object_p->*member_p)) - reinterpret_cast<uint8 *>(default_object_p));
+    property_p->m_copy_func_p = [](void * dest_p, const void * src_p) { *static_cast<_ValueType *>(dest_p) = *static_cast<const _ValueType *>(src_p); };
+    class_p->m_properties.push_back(property_p);
+
+    for (const TCHAR * prefix_p : { TEXT("Echo"), TEXT("StaticEcho") })
+      {
+      UFunction * function_p = new UFunction;
+      function_p->m_name = FName((std::string(prefix_p) + function_suffix_p).c_str());
+      function_p->ParmsSize = uint16(sizeof(FEchoParms<_ValueType>));
+      function_p->m_native_func_p = &exec_echo<_ValueType>;
+      class_p->m_functions.push_back(function_p);
+      }
+    }
+
+  } // namespace
+
+//---------------------------------------------------------------------------------------
+
+UClass * UBenchObject::StaticClass()
+  {
+  static UClass * s_class_p = nullptr;
+  if (!s_class_p)
+    {
+    s_class_p = new UClass;
+    s_class_p->m_name = FName(TEXT("BenchObject"));
+
+    UBenchObject * default_object_p = new UBenchObject;
+    default_object_p->m_class_p = s_class_p;
+    s_class_p->m_default_object_p = default_object_p;
+
+    add_shape(s_class_p, default_object_p, &UBenchObject::IntValue,            TEXT("IntValue"),            TEXT("Int"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::RealValue,           TEXT("RealValue"),           TEXT("Real"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::bBoolValue,          TEXT("bBoolValue"),          TEXT("Bool"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::StringValue,         TEXT("StringValue"),         TEXT("String"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::NameValue,           TEXT("NameValue"),           TEXT("Name"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::Vector2Value,        TEXT("Vector2Value"),        TEXT("Vector2"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::Vector3Value,        TEXT("Vector3Value"),        TEXT("Vector3"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::Vector4Value,        TEXT("Vector4Value"),        TEXT("Vector4"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::RotationValue,       TEXT("RotationValue"),       TEXT("Rotation"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::RotationAnglesValue, TEXT("RotationAnglesValue"), TEXT("RotationAngles"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::TransformValue,      TEXT("TransformValue"),      TEXT("Transform"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::ColorValue,          TEXT("ColorValue"),          TEXT("Color"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::ClassValue,          TEXT("ClassValue"),          TEXT("Class"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::ObjectValue,         TEXT("ObjectValue"),         TEXT("Object"));
+    add_shape(s_class_p, default_object_p, &UBenchObject::ListValue,           TEXT("ListValue"),           TEXT("List"));
+    }
+  return s_class_p;
+  }
@@ -0,0 +1,34 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Engine class the benchmarked bindings are generated for - one property plus an
+// instance and a static echo function per eSkTypeID shape, see BenchSnapshot.cpp
+//=======================================================================================
+
+#pragma once
+
+#include "StandIns/EngineStandIns.hpp"
+
+class UBenchObject : public UObject
+  {
+  public:
+
+    static UClass * StaticClass(); // Reflection data with a native thunk per function, built on first call
+
+    int32         IntValue = 0;
+    float         RealValue = 0.0f;
+    bool          bBoolValue = false;
+    FString       StringValue;
+    FName         NameValue;
+    FVector2D     Vector2Value = FVector2D(ForceInitToZero);
+    FVector       Vector3Value = FVector(ForceInitToZero);
+    FVector4      Vector4Value = FVector4(ForceInitToZero);
+    FQuat         RotationValue = FQuat(ForceInitToZero);
+    FRotator      RotationAnglesValue = FRotator(ForceInitToZero);
+    FTransform    TransformValue;
+    FLinearColor  ColorValue = FLinearColor(ForceInitToZero);
+    UClass *      ClassValue = nullptr;
+    UObject *     ObjectValue = nullptr;
+    TArray<int32> ListValue;
+  };
@@ -0,0 +1,191 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Writes the reflection snapshot of UBenchObject - one property plus an instance and a
+// static function per eSkTypeID shape - for the offline generator to produce the bindings
+// the benchmark compiles
+//=======================================================================================
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+  {
+
+  // Flag values as defined by the engine - must match OfflineGenerator/Source/ReflectionModel.hpp
+  const uint32_t CLASS_RequiredAPI = 0x00100000u;
+  const uint32_t FUNC_Static       = 0x00002000u;
+  const uint64_t CPF_Edit          = 0x0000000000000001ull;
+  const uint64_t CPF_Parm          = 0x0000000000000080ull;
+  const uint64_t CPF_ReturnParm    = 0x0000000000000400ull;
+
+  // One benchmarked shape - property <m_property_name_p>, functions Echo<m_function_suffix_p> and StaticEcho<m_function_suffix_p>
+  struct Shape
+    {
+    const char * m_property_name_p;
+    const char * m_function_suffix_p;
+    const char * m_property_class_name_p;
+    const char * m_cpp_type_name_p;
+    const char * m_type_object_name_p;
+    const char * m_inner_property_class_name_p; // Element of an ArrayProperty, nullptr otherwise
+    const char * m_inner_cpp_type_name_p;
+    };
+
+  const Shape ms_shapes[] =
+    {
+      { "IntValue",            "Int",            "IntProperty",    "int32",         "",            nullptr,       nullptr },
+      { "RealValue",           "Real",           "FloatProperty",  "float",         "",            nullptr,       nullptr },
+      { "bBoolValue",          "Bool",           "BoolProperty",   "bool",          "",            nullptr,       nullptr },
+      { "StringValue",         "String",         "StrProperty",    "FString",       "",            nullptr,       nullptr },
+      { "NameValue",           "Name",           "NameProperty",   "FName",         "",            nullptr,       nullptr },
+      { "Vector2Value",        "Vector2",        "StructProperty", "FVector2D",     "Vector2D",    nullptr,       nullptr },
+      { "Vector3Value",        "Vector3",        "StructProperty", "FVector",       "Vector",      nullptr,       nullptr },
+      { "Vector4Value",        "Vector4",        "StructProperty", "FVector4",      "Vector4",     nullptr,       nullptr },
+      { "RotationValue",       "Rotation",       "StructProperty", "FQuat",         "Quat",        nullptr,       nullptr },
+      { "RotationAnglesValue", "RotationAngles", "StructProperty", "FRotator",      "Rotator",     nullptr,       nullptr },
+      { "TransformValue",      "Transform",      "StructProperty", "FTransform",    "Transform",   nullptr,       nullptr },
+      { "ColorValue",          "Color",          "StructProperty", "FLinearColor",  "LinearColor", nullptr,       nullptr },
+      { "ClassValue",          "Class",          "ClassProperty",  "UClass*",       "Object",      nullptr,       nullptr },
+      { "ObjectValue",         "Object",         "ObjectProperty", "UObject*",      "Object",      nullptr,       nullptr },
+      { "ListValue",           "List",           "ArrayProperty",  "TArray<int32>", "",            "IntProperty", "int32" },
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Serializes in the layout FSkookumScriptGenerator::save_reflection_snapshot() writes and SkSnapshotReader reads
+
+  class SnapshotWriter
+    {
+    public:
+
+      void write_class(const std::string & source_header_file_name)
+        {
+        std::vector<uint8_t> functions;
+        std::vector<uint8_t> properties;
+        int32_t function_count = 0;
+        for (const Shape & shape : ms_shapes)
+          {
+          for (bool is_static : { false, true })
+            {
+            write_name(&functions, std::string(is_static ? "StaticEcho" : "Echo") + shape.m_function_suffix_p);
+            write_name(&functions, "BenchObject");
+            write(&functions, is_static ? FUNC_Static : 0u);
+            write(&functions, int32_t(0)); // Meta data
+            write(&functions, int32_t(2));
+            write_property(&functions, shape, "Value", CPF_Parm);
+            write_property(&functions, shape, "ReturnValue", CPF_Parm | CPF_ReturnParm);
+            ++function_count;
+            }
+          write_name(&properties, "BenchObject");
+          write_property(&properties, shape, shape.m_property_name_p, CPF_Edit);
+          }
+
+        write_name(&m_body, "BenchObject");
+        write_name(&m_body, "U");
+        write_name(&m_body, source_header_file_name);
+        write(&m_body, CLASS_RequiredAPI);
+        write(&m_body, uint64_t(0)); // Cast flags
+        write(&m_body, int32_t(0)); // Meta data
+        write(&m_body, int32_t(1)); // Super classes
+        write_name(&m_body, "Object");
+        write(&m_body, function_count);
+        m_body.insert(m_body.end(), functions.begin(), functions.end());
+        write(&m_body, int32_t(sizeof(ms_shapes) / sizeof(ms_shapes[0])));
+        m_body.insert(m_body.end(), properties.begin(), properties.end());
+        }
+
+      bool save(const std::string & file_path)
+        {
+        std::vector<uint8_t> data;
+        write(&data, uint32_t(0x53524b53u)); // 'SKRS'
+        write(&data, uint32_t(2u));
+        write(&data, int32_t(m_names.size()));
+        for (const std::string & name : m_names)
+          {
+          write(&data, int32_t(name.length()));
+          data.insert(data.end(), name.begin(), name.end());
+          }
+        write(&data, int32_t(1)); // Classes
+        data.insert(data.end(), m_body.begin(), m_body.end());
+        write(&data, int32_t(0)); // Structs
+        write(&data, int32_t(0)); // Enums
+
+        std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(data.data()), data.size());
+        return bool(file);
+        }
+
+    protected:
+
+      template<typename _Type>
+      static void write(std::vector<uint8_t> * data_p, _Type value)
+        {
+        uint8_t bytes[sizeof(_Type)];
+        std::memcpy(bytes, &value, sizeof(_Type)); // Snapshots are little endian, just like every platform UHT runs on
+        data_p->insert(data_p->end(), bytes, bytes + sizeof(_Type));
+        }
+
+      void write_name(std::vector<uint8_t> * data_p, const std::string & name)
+        {
+        auto result = m_name_indices.emplace(name, int32_t(m_names.size()));
+        if (result.second)
+          {
+          m_names.push_back(name);
+          }
+        write(data_p, result.first->second);
+        }
+
+      void write_property(std::vector<uint8_t> * data_p, const Shape & shape, const char * name_p, uint64_t property_flags)
+        {
+        write_name(data_p, name_p);
+        write_name(data_p, shape.m_property_class_name_p);
+        write_name(data_p, shape.m_cpp_type_name_p);
+        write(data_p, property_flags);
+        write(data_p, int32_t(1)); // Array dim
+        write(data_p, int32_t(0)); // Meta data
+        write_name(data_p, shape.m_type_object_name_p);
+        write(data_p, uint8_t(shape.m_inner_property_class_name_p ? 1 : 0));
+        if (shape.m_inner_property_class_name_p)
+          {
+          write_name(data_p, name_p);
+          write_name(data_p, shape.m_inner_property_class_name_p);
+          write_name(data_p, shape.m_inner_cpp_type_name_p);
+          write(data_p, uint64_t(0));
+          write(data_p, int32_t(1));
+          write(data_p, int32_t(0));
+          write_name(data_p, "");
+          write(data_p, uint8_t(0));
+          }
+        }
+
+      std::vector<std::string>                 m_names;
+      std::unordered_map<std::string, int32_t> m_name_indices;
+      std::vector<uint8_t>                     m_body; // The class record - written after the names table it refers to
+    };
+
+  } // namespace
+
+//---------------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+  {
+  if (argc != 3)
+    {
+    std::cerr << "Usage: SkookumScriptBenchSnapshot <snapshot> <source header of UBenchObject>\n";
+    return 2;
+    }
+
+  SnapshotWriter writer;
+  writer.write_class(argv[2]);
+  if (!writer.save(argv[1]))
+    {
+    std::cerr << "Error: Could not write reflection snapshot: " << argv[1] << "\n";
+    return 1;
+    }
+  return 0;
+  }
@@ -0,0 +1,11 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Compiles the benchmarked bindings - the master binding file written by the offline
+// generator, just like the runtime plugin includes it, plus the batched variants
+//=======================================================================================
+
+#include "SkUE.generated.inl"
+
+#include "BatchBindings.inl"
@@ -0,0 +1,47 @@
+#pragma once
+
+// Conversion between script lists and contiguous arrays for batched bindings
+class SkUEBatch
+  {
+  public:
+
+    // Contiguous 16 byte aligned storage for FVector, FQuat and FTransform elements
+    template<typename _CppType>
+    using tAlignedArray = TArray<_CppType, TAlignedHeapAllocator<16>>;
+
+    // Unpacks list argument arg_idx into values_p - must have one element per receiver
+    template<class _BindingClass, typename _CppType, typename _Allocator>
+    static void unpack(SkInvokedMethod * scope_p, uint32 arg_idx, uint32 count, TArray<_CppType, _Allocator> * values_p)
+      {
+      const APArray<SkInstance> & instances = scope_p->get_arg<SkList>(arg_idx).get_instances();
+      SK_ASSERTX(instances.get_length() == count, "Batched argument lists must have the same length as the list of receivers.");
+      uint32 length = FMath::Min(count, instances.get_length());
+      SkInstance ** instances_pp = instances.get_array();
+      values_p->Reset(count);
+      for (uint32 i = 0; i < length; ++i)
+        {
+        values_p->Add(SkMarshal<_BindingClass>::from_instance(instances_pp[i]));
+        }
+      values_p->AddDefaulted(count - length);
+      }
+
+    // Packs values into a new list instance
+    template<class _BindingClass, typename _CppType>
+    static SkInstance * pack(const TArray<_CppType> & values)
+      {
+      return SkMarshal<SkUEList<_BindingClass, _CppType>>::to_result(values);
+      }
+
+    template<class _BindingClass, typename _CppType>
+    static SkInstance * pack(const tAlignedArray<_CppType> & values)
+      {
+      SkInstance * list_p = SkList::new_instance(values.Num());
+      SkInstanceList & list = list_p->as<SkList>();
+      for (const _CppType & value : values)
+        {
+        list.append(*SkMarshal<_BindingClass>::to_result(value), false); // Take over the reference of the new instance
+        }
+      return list_p;
+      }
+
+  };
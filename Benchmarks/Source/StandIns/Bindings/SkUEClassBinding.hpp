@@ -0,0 +1,56 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Minimal stand-ins for the runtime plugin's engine type bindings and class binding
+// helpers generated bindings build on
+//=======================================================================================
+
+#pragma once
+
+#include "../SkookumScript/SkStandIns.hpp"
+
+//---------------------------------------------------------------------------------------
+// Engine value types
+
+class SkUEName         : public SkClassBindingSimple<SkUEName, FName> {};
+class SkVector2        : public SkClassBindingSimple<SkVector2, FVector2D> {};
+class SkVector3        : public SkClassBindingSimple<SkVector3, FVector> {};
+class SkVector4        : public SkClassBindingSimple<SkVector4, FVector4> {};
+class SkRotation       : public SkClassBindingSimple<SkRotation, FQuat> {};
+class SkRotationAngles : public SkClassBindingSimple<SkRotationAngles, FRotator> {};
+class SkTransform      : public SkClassBindingSimple<SkTransform, FTransform> {};
+class SkColor          : public SkClassBindingSimple<SkColor, FLinearColor> {};
+
+//---------------------------------------------------------------------------------------
+// Engine objects - the instance stores the object pointer
+
+template<class _BindingClass, class _UObjectType>
+class SkUEClassBindingEntity : public SkClassBindingSimple<_BindingClass, _UObjectType *>
+  {
+  public:
+
+    typedef SkUEClassBindingEntity tBindingBase;
+
+    static void register_bindings(uint32 class_name_id) { SkClassBindingSimple<_BindingClass, _UObjectType *>::ms_class_p = SkBrain::get_class(class_name_id); }
+
+    static UClass * ms_uclass_p;
+  };
+
+template<class _BindingClass, class _UObjectType>
+UClass * SkUEClassBindingEntity<_BindingClass, _UObjectType>::ms_uclass_p = nullptr;
+
+class SkUEEntity      : public SkUEClassBindingEntity<SkUEEntity, UObject> {};
+class SkUEEntityClass : public SkClassBindingSimple<SkUEEntityClass, UClass *> {};
+
+//---------------------------------------------------------------------------------------
+
+class SkUEClassBindingHelper
+  {
+  public:
+
+    static UProperty * find_class_property(UClass * class_p, const TCHAR * property_name_p) { return class_p->FindPropertyByName(FName(property_name_p)); }
+
+    static TMap<UClass *, SkClass *> ms_class_map_u2s;
+    static TMap<SkClass *, UClass *> ms_class_map_s2u;
+  };
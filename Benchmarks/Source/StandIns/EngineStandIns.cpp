@@ -0,0 +1,56 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Out of line parts of the engine stand-ins - kept in their own translation unit so the
+// compiler cannot fold them into the binding bodies, just like calls into the engine
+//=======================================================================================
+
+#include "EngineStandIns.hpp"
+
+//---------------------------------------------------------------------------------------
+
+FName::FName(const TCHAR * name_p)
+  {
+  static std::unordered_map<std::string, int32> s_name_indices = { { "None", 0 } };
+  auto result = s_name_indices.emplace(name_p, int32(s_name_indices.size()));
+  m_index = result.first->second;
+  }
+
+//---------------------------------------------------------------------------------------
+
+UFunction * UObject::FindFunctionChecked(FName name) const
+  {
+  UFunction * function_p = m_class_p->FindFunctionByName(name);
+  check(function_p);
+  return function_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void UObject::ProcessEvent(UFunction * function_p, void * parms_p)
+  {
+  function_p->m_native_func_p(this, parms_p);
+  }
+
+//---------------------------------------------------------------------------------------
+
+UFunction * UClass::FindFunctionByName(FName name) const
+  {
+  for (UFunction * function_p : m_functions)
+    {
+    if (function_p->GetFName() == name) return function_p;
+    }
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+UProperty * UClass::FindPropertyByName(FName name) const
+  {
+  for (UProperty * property_p : m_properties)
+    {
+    if (property_p->GetFName() == name) return property_p;
+    }
+  return nullptr;
+  }
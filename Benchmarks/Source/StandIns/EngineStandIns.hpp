@@ -0,0 +1,319 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Minimal stand-ins for the engine types generated bindings touch, so binding bodies
+// compile and run on plain Linux - only what the bindings use, with the same shapes
+// (sizes, alignment, heap behavior) as the engine where it matters for cost
+//=======================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+typedef int32_t  int32;
+typedef uint32_t uint32;
+typedef uint16_t uint16;
+typedef uint8_t  uint8;
+typedef int64_t  int64;
+typedef uint64_t uint64;
+typedef char     TCHAR;
+
+#define TEXT(text)  text
+
+#if defined(_MSC_VER)
+  #define FORCEINLINE __forceinline
+#else
+  #define FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+// Kept enabled, just like in the development builds bindings get profiled in
+#define check(expr) do { if (!(expr)) std::abort(); } while (false)
+
+enum EForceInit { ForceInit, ForceInitToZero };
+
+template<typename _Type>
+FORCEINLINE typename std::remove_reference<_Type>::type && MoveTemp(_Type && value) { return static_cast<typename std::remove_reference<_Type>::type &&>(value); }
+
+struct FMath
+  {
+  template<typename _Type>
+  static FORCEINLINE _Type Min(_Type a, _Type b) { return a < b ? a : b; }
+  };
+
+//---------------------------------------------------------------------------------------
+// Containers
+
+struct FDefaultAllocator {};
+
+template<uint32 _Alignment>
+struct TAlignedHeapAllocator {};
+
+// Maps an engine allocator tag onto a std allocator with the same alignment
+template<typename _ElemType, typename _Allocator>
+struct TStdAllocator
+  {
+  typedef std::allocator<_ElemType> tType;
+  };
+
+template<typename _ElemType, uint32 _Alignment>
+struct TStdAllocator<_ElemType, TAlignedHeapAllocator<_Alignment>>
+  {
+  struct tType
+    {
+    typedef _ElemType value_type;
+
+    tType() = default;
+    template<typename _OtherType> tType(const typename TStdAllocator<_OtherType, TAlignedHeapAllocator<_Alignment>>::tType &) {}
+    template<typename _OtherType> struct rebind { typedef typename TStdAllocator<_OtherType, TAlignedHeapAllocator<_Alignment>>::tType other; };
+
+    _ElemType * allocate(size_t count)              { return static_cast<_ElemType *>(::operator new(count * sizeof(_ElemType), std::align_val_t(_Alignment))); }
+    void        deallocate(_ElemType * elems_p, size_t) { ::operator delete(elems_p, std::align_val_t(_Alignment)); }
+
+    bool operator == (const tType &) const { return true; }
+    bool operator != (const tType &) const { return false; }
+    };
+  };
+
+template<typename _ElemType, typename _Allocator = FDefaultAllocator>
+class TArray
+  {
+  public:
+
+    int32       Num() const                   { return int32(m_elems.size()); }
+    void        Reserve(int32 count)          { m_elems.reserve(count); }
+    void        Reset(int32 count = 0)        { m_elems.clear(); m_elems.reserve(count); } // Keeps the allocation if large enough
+    int32       Add(const _ElemType & elem)   { m_elems.push_back(elem); return Num() - 1; }
+    int32       Add(_ElemType && elem)        { m_elems.push_back(MoveTemp(elem)); return Num() - 1; }
+    void        AddDefaulted(int32 count)     { m_elems.resize(m_elems.size() + count); }
+    _ElemType * GetData()                     { return m_elems.data(); }
+
+    _ElemType &       operator [] (int32 index)       { return m_elems[index]; }
+    const _ElemType & operator [] (int32 index) const { return m_elems[index]; }
+
+    _ElemType *       begin()       { return m_elems.data(); }
+    _ElemType *       end()         { return m_elems.data() + m_elems.size(); }
+    const _ElemType * begin() const { return m_elems.data(); }
+    const _ElemType * end() const   { return m_elems.data() + m_elems.size(); }
+
+  protected:
+
+    std::vector<_ElemType, typename TStdAllocator<_ElemType, _Allocator>::tType> m_elems;
+  };
+
+template<typename _KeyType, typename _ValueType>
+class TMap
+  {
+  public:
+
+    void Reset()                                              { m_pairs.clear(); }
+    void Reserve(int32 count)                                 { m_pairs.reserve(count); }
+    void Add(const _KeyType & key, const _ValueType & value)  { m_pairs[key] = value; }
+
+  protected:
+
+    std::unordered_map<_KeyType, _ValueType> m_pairs;
+  };
+
+//---------------------------------------------------------------------------------------
+// Strings and names
+
+// Like the engine's, the characters always live on the heap
+class FString
+  {
+  public:
+
+    FString() {}
+    FString(const TCHAR * chars_p)
+      {
+      const int32 length = int32(std::strlen(chars_p));
+      if (length)
+        {
+        m_chars.Reserve(length + 1);
+        for (int32 i = 0; i <= length; ++i) m_chars.Add(chars_p[i]);
+        }
+      }
+
+    const TCHAR * operator * () const { return m_chars.Num() ? &m_chars[0] : TEXT(""); }
+    int32         Len() const         { return m_chars.Num() ? m_chars.Num() - 1 : 0; }
+
+  protected:
+
+    TArray<TCHAR> m_chars; // Zero terminated, empty if the string is
+  };
+
+// Index into a global name table, like the engine's - comparing and copying are free, constructing from a string is a lookup
+class FName
+  {
+  public:
+
+    FName() : m_index(0) {}
+    FName(const TCHAR * name_p);
+
+    bool operator == (const FName & other) const { return m_index == other.m_index; }
+    int32 GetComparisonIndex() const             { return m_index; }
+
+  protected:
+
+    int32 m_index; // 0 = NAME_None
+  };
+
+namespace std
+  {
+  template<> struct hash<FName> { size_t operator () (const FName & name) const { return size_t(name.GetComparisonIndex()); } };
+  }
+
+//---------------------------------------------------------------------------------------
+// Math - sizes and alignment as in the engine
+
+struct FVector2D
+  {
+  float X, Y;
+
+  FVector2D() {}
+  explicit FVector2D(EForceInit) : X(0.0f), Y(0.0f) {}
+  FVector2D(float x, float y) : X(x), Y(y) {}
+  };
+
+struct FVector
+  {
+  float X, Y, Z;
+
+  FVector() {}
+  explicit FVector(EForceInit) : X(0.0f), Y(0.0f), Z(0.0f) {}
+  FVector(float x, float y, float z) : X(x), Y(y), Z(z) {}
+  };
+
+struct alignas(16) FVector4
+  {
+  float X, Y, Z, W;
+
+  FVector4() : X(0.0f), Y(0.0f), Z(0.0f), W(1.0f) {}
+  explicit FVector4(EForceInit) : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {}
+  FVector4(float x, float y, float z, float w) : X(x), Y(y), Z(z), W(w) {}
+  };
+
+struct alignas(16) FQuat
+  {
+  float X, Y, Z, W;
+
+  FQuat() {}
+  explicit FQuat(EForceInit) : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {}
+  FQuat(float x, float y, float z, float w) : X(x), Y(y), Z(z), W(w) {}
+  };
+
+struct FRotator
+  {
+  float Pitch, Yaw, Roll;
+
+  FRotator() {}
+  explicit FRotator(EForceInit) : Pitch(0.0f), Yaw(0.0f), Roll(0.0f) {}
+  FRotator(float pitch, float yaw, float roll) : Pitch(pitch), Yaw(yaw), Roll(roll) {}
+  };
+
+// Three vector registers like the SIMD version of the engine's - 48 bytes, 16 byte aligned
+struct alignas(16) FTransform
+  {
+  FQuat    Rotation;
+  FVector4 Translation;
+  FVector4 Scale3D;
+
+  FTransform() : Rotation(0.0f, 0.0f, 0.0f, 1.0f), Translation(0.0f, 0.0f, 0.0f, 0.0f), Scale3D(1.0f, 1.0f, 1.0f, 0.0f) {}
+  };
+
+struct FLinearColor
+  {
+  float R, G, B, A;
+
+  FLinearColor() {}
+  explicit FLinearColor(EForceInit) : R(0.0f), G(0.0f), B(0.0f), A(0.0f) {}
+  FLinearColor(float r, float g, float b, float a) : R(r), G(g), B(b), A(a) {}
+  };
+
+//---------------------------------------------------------------------------------------
+// Reflection
+
+class UClass;
+class UFunction;
+class UProperty;
+
+class UObject
+  {
+  public:
+
+    virtual ~UObject() {}
+
+    UClass *    GetClass() const { return m_class_p; }
+    UFunction * FindFunctionChecked(FName name) const;
+
+    // Out of line like the engine's - invokes the function's native thunk on the parameter block
+    virtual void ProcessEvent(UFunction * function_p, void * parms_p);
+
+    UClass * m_class_p = nullptr;
+  };
+
+class UField : public UObject
+  {
+  public:
+
+    FName GetFName() const { return m_name; }
+
+    FName m_name;
+  };
+
+// Native thunk - reads its arguments from and writes its return value into the parameter block
+typedef void (*tNativeFunc)(UObject * context_p, void * parms_p);
+
+class UFunction : public UField
+  {
+  public:
+
+    uint16      ParmsSize = 0;
+    tNativeFunc m_native_func_p = nullptr;
+  };
+
+class UProperty : public UField
+  {
+  public:
+
+    template<typename _ValueType>
+    _ValueType * ContainerPtrToValuePtr(void * container_p) const { return reinterpret_cast<_ValueType *>(static_cast<uint8 *>(container_p) + m_offset); }
+
+    void CopyCompleteValue(void * dest_p, const void * src_p) const { m_copy_func_p(dest_p, src_p); }
+
+    int32 m_offset = 0;
+    void  (*m_copy_func_p)(void * dest_p, const void * src_p) = nullptr;
+  };
+
+class UClass : public UField
+  {
+  public:
+
+    UObject *   GetDefaultObject() const { return m_default_object_p; }
+    UFunction * FindFunctionByName(FName name) const;
+    UProperty * FindPropertyByName(FName name) const;
+
+    UObject *                m_default_object_p = nullptr;
+    std::vector<UFunction *> m_functions;
+    std::vector<UProperty *> m_properties;
+  };
+
+template<class _ObjectType>
+_ObjectType * GetMutableDefault(UClass * class_p) { return static_cast<_ObjectType *>(class_p->GetDefaultObject()); }
+
+template<class _ObjectType>
+_ObjectType * NewObject()
+  {
+  _ObjectType * object_p = new _ObjectType;
+  object_p->m_class_p = _ObjectType::StaticClass();
+  return object_p;
+  }
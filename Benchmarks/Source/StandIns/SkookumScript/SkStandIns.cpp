@@ -0,0 +1,104 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Out of line parts of the SkookumScript runtime stand-ins
+//=======================================================================================
+
+#include "SkStandIns.hpp"
+#include "../Bindings/SkUEClassBinding.hpp"
+
+uint64 SkInstance::ms_new_instance_count = 0u;
+
+TMap<UClass *, SkClass *> SkUEClassBindingHelper::ms_class_map_u2s;
+TMap<SkClass *, UClass *> SkUEClassBindingHelper::ms_class_map_s2u;
+
+namespace
+  {
+
+  std::vector<SkInstance *> & get_instance_pool()
+    {
+    static std::vector<SkInstance *> s_pool;
+    return s_pool;
+    }
+
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkInstance * SkInstance::pool_pop(SkClass * class_p)
+  {
+  std::vector<SkInstance *> & pool = get_instance_pool();
+  SkInstance * instance_p;
+  if (pool.empty())
+    {
+    instance_p = new SkInstance;
+    }
+  else
+    {
+    instance_p = pool.back();
+    pool.pop_back();
+    }
+  instance_p->m_ref_count = 1u;
+  instance_p->m_is_data_on_heap = false;
+  instance_p->m_class_p = class_p;
+  ++ms_new_instance_count;
+  return instance_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkInstance::release()
+  {
+  m_destruct_func_p(this);
+  get_instance_pool().push_back(this);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkClass::register_method_func_bulk(const MethodInitializerFuncId * bindings_p, uint32 count, eSkBindFlag flags)
+  {
+  std::unordered_map<uint32, tSkMethodFunc> & methods = (flags == SkBindFlag_class_no_rebind) ? m_class_methods : m_instance_methods;
+  for (uint32 i = 0u; i < count; ++i)
+    {
+    methods[bindings_p[i].m_method_name_id] = bindings_p[i].m_method_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+tSkMethodFunc SkClass::find_method_func(const char * name_p, bool is_class) const
+  {
+  const std::unordered_map<uint32, tSkMethodFunc> & methods = is_class ? m_class_methods : m_instance_methods;
+  auto method_it = methods.find(SkBrain::get_name_id(name_p));
+  return method_it != methods.end() ? method_it->second : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkClass * SkBrain::get_class(uint32 name_id)
+  {
+  static std::unordered_map<uint32, SkClass *> s_classes;
+  SkClass *& class_p = s_classes[name_id];
+  if (!class_p)
+    {
+    class_p = new SkClass(name_id);
+    }
+  return class_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+uint32 SkBrain::get_name_id(const char * name_p)
+  {
+  uint32 crc = 0xffffffffu;
+  for (; *name_p; ++name_p)
+    {
+    crc ^= uint8(*name_p);
+    for (int32 bit = 0; bit < 8; ++bit)
+      {
+      crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+      }
+    }
+  return ~crc;
+  }
@@ -0,0 +1,278 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Minimal stand-ins for the SkookumScript runtime types generated bindings touch -
+// pooled, reference counted instances with in-place user data, argument access and
+// method registration. The SkookumScript/*.hpp headers bindings include all forward here.
+//=======================================================================================
+
+#pragma once
+
+#include "../EngineStandIns.hpp"
+
+#include <cstdio>
+
+#define SK_ASSERTX(exp, msg) do { if (!(exp)) { std::fprintf(stderr, "%s\n", msg); std::abort(); } } while (false)
+
+enum eSkArgNum
+  {
+  SkArg_1 = 0,
+  SkArg_2,
+  SkArg_3,
+  SkArg_4,
+  };
+
+enum eSkBindFlag
+  {
+  SkBindFlag_instance_no_rebind,
+  SkBindFlag_class_no_rebind,
+  };
+
+class SkClass;
+class SkInstance;
+class SkInvokedMethod;
+
+//---------------------------------------------------------------------------------------
+// Reference counted heap string - copies share the characters, like the runtime's
+
+class AString
+  {
+  public:
+
+    AString() : m_str_ref_p(nullptr) {}
+    AString(const char * chars_p, uint32 length) : m_str_ref_p(static_cast<StringRef *>(::operator new(sizeof(StringRef) + length)))
+      {
+      m_str_ref_p->m_ref_count = 1u;
+      std::memcpy(m_str_ref_p->m_chars, chars_p, length);
+      m_str_ref_p->m_chars[length] = '\0';
+      }
+    AString(const AString & other) : m_str_ref_p(other.m_str_ref_p) { if (m_str_ref_p) ++m_str_ref_p->m_ref_count; }
+    ~AString() { if (m_str_ref_p && --m_str_ref_p->m_ref_count == 0u) ::operator delete(m_str_ref_p); }
+
+    AString & operator = (const AString & other) = delete;
+
+    const char * as_cstr() const { return m_str_ref_p ? m_str_ref_p->m_chars : ""; }
+
+  protected:
+
+    struct StringRef
+      {
+      uint32 m_ref_count;
+      char   m_chars[1]; // Zero terminated, allocated to length
+      };
+
+    StringRef * m_str_ref_p;
+  };
+
+//---------------------------------------------------------------------------------------
+// Growable array of pointers - pointer, length and size like the runtime's
+
+template<class _ElemType>
+class APArray
+  {
+  public:
+
+    APArray() : m_array_p(nullptr), m_count(0u), m_size(0u) {}
+    APArray(const APArray &) = delete;
+    ~APArray() { delete [] m_array_p; }
+
+    uint32       get_length() const { return m_count; }
+    _ElemType ** get_array() const  { return m_array_p; }
+
+    void ensure_size(uint32 size)
+      {
+      if (size > m_size)
+        {
+        _ElemType ** array_p = new _ElemType *[size];
+        if (m_count) std::memcpy(array_p, m_array_p, m_count * sizeof(_ElemType *));
+        delete [] m_array_p;
+        m_array_p = array_p;
+        m_size = size;
+        }
+      }
+
+    void append(_ElemType & elem)
+      {
+      if (m_count == m_size) ensure_size(m_size ? m_size * 2u : 4u);
+      m_array_p[m_count++] = &elem;
+      }
+
+  protected:
+
+    _ElemType ** m_array_p;
+    uint32       m_count;
+    uint32       m_size;
+  };
+
+//---------------------------------------------------------------------------------------
+// Pooled, reference counted script object - data up to the size of the user data is stored
+// in place, anything larger in a separate heap block
+
+class SkInstance
+  {
+  public:
+
+    enum { UserData_size = 16 };
+
+    template<class _BindingClass>
+    typename _BindingClass::tDataType & as() const { return *static_cast<typename _BindingClass::tDataType *>(get_data_p()); }
+
+    void reference()   { ++m_ref_count; }
+    void dereference() { if (--m_ref_count == 0u) release(); }
+
+    // Takes an instance from the pool holding a _DataType constructed from args, with one reference
+    template<typename _DataType, typename... _ArgTypes>
+    static SkInstance * new_instance(SkClass * class_p, _ArgTypes &&... args)
+      {
+      SkInstance * instance_p = pool_pop(class_p);
+      if constexpr (sizeof(_DataType) <= UserData_size && alignof(_DataType) <= 16u)
+        {
+        new (instance_p->m_user_data) _DataType(std::forward<_ArgTypes>(args)...);
+        instance_p->m_destruct_func_p = [](SkInstance * released_p) { static_cast<_DataType *>(released_p->get_data_p())->~_DataType(); };
+        }
+      else
+        {
+        *reinterpret_cast<_DataType **>(instance_p->m_user_data) = new _DataType(std::forward<_ArgTypes>(args)...);
+        instance_p->m_is_data_on_heap = true;
+        instance_p->m_destruct_func_p = [](SkInstance * released_p) { delete static_cast<_DataType *>(released_p->get_data_p()); };
+        }
+      return instance_p;
+      }
+
+    static uint64 ms_new_instance_count; // Instances taken from the pool so far
+
+  protected:
+
+    void * get_data_p() const { return m_is_data_on_heap ? *reinterpret_cast<void * const *>(m_user_data) : const_cast<uint8 *>(m_user_data); }
+
+    static SkInstance * pool_pop(SkClass * class_p);
+    void                release();
+
+    uint32  m_ref_count = 1u;
+    bool    m_is_data_on_heap = false;
+    SkClass * m_class_p = nullptr;
+    void    (*m_destruct_func_p)(SkInstance * instance_p) = nullptr;
+    alignas(16) uint8 m_user_data[UserData_size];
+  };
+
+//---------------------------------------------------------------------------------------
+// Base of binding classes whose instances store a _DataType
+
+template<class _BindingClass, typename _DataType>
+class SkClassBindingSimple
+  {
+  public:
+
+    typedef _DataType tDataType;
+
+    static SkInstance * new_instance(const tDataType & value) { return SkInstance::new_instance<tDataType>(ms_class_p, value); }
+
+    static SkClass * ms_class_p;
+  };
+
+template<class _BindingClass, typename _DataType>
+SkClass * SkClassBindingSimple<_BindingClass, _DataType>::ms_class_p = nullptr;
+
+class SkInteger : public SkClassBindingSimple<SkInteger, int32> {};
+class SkReal    : public SkClassBindingSimple<SkReal, float> {};
+class SkBoolean : public SkClassBindingSimple<SkBoolean, bool> {};
+class SkString  : public SkClassBindingSimple<SkString, AString> {};
+
+//---------------------------------------------------------------------------------------
+// Data of a List instance - holds a reference to each element
+
+class SkInstanceList
+  {
+  public:
+
+    SkInstanceList() {}
+    SkInstanceList(const SkInstanceList &) = delete;
+    ~SkInstanceList()
+      {
+      for (uint32 i = 0u; i < m_instances.get_length(); ++i) m_instances.get_array()[i]->dereference();
+      }
+
+    const APArray<SkInstance> & get_instances() const { return m_instances; }
+
+    void ensure_size(uint32 size) { m_instances.ensure_size(size); }
+    void append(SkInstance & instance, bool reference = true) { if (reference) instance.reference(); m_instances.append(instance); }
+
+  protected:
+
+    APArray<SkInstance> m_instances;
+  };
+
+class SkList : public SkClassBindingSimple<SkList, SkInstanceList>
+  {
+  public:
+
+    static SkInstance * new_instance(uint32 ensure_size)
+      {
+      SkInstance * instance_p = SkInstance::new_instance<SkInstanceList>(ms_class_p);
+      instance_p->as<SkList>().ensure_size(ensure_size);
+      return instance_p;
+      }
+  };
+
+//---------------------------------------------------------------------------------------
+// Call scope of a bound method - receiver plus argument instances
+
+class SkInvokedContextBase
+  {
+  public:
+
+    SkInvokedContextBase(SkInstance * this_p, SkInstance * const * args_pp) : m_this_p(this_p), m_args_pp(args_pp) {}
+
+    template<class _BindingClass>
+    typename _BindingClass::tDataType & get_arg(uint32 arg_idx) const { return m_args_pp[arg_idx]->as<_BindingClass>(); }
+
+  protected:
+
+    SkInstance *        m_this_p;
+    SkInstance * const * m_args_pp;
+  };
+
+class SkInvokedMethod : public SkInvokedContextBase
+  {
+  public:
+
+    SkInvokedMethod(SkInstance * this_p, SkInstance * const * args_pp) : SkInvokedContextBase(this_p, args_pp) {}
+
+    template<class _BindingClass>
+    typename _BindingClass::tDataType this_as() const { return m_this_p->as<_BindingClass>(); }
+  };
+
+//---------------------------------------------------------------------------------------
+// Script class - only its method table
+
+typedef void (*tSkMethodFunc)(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+
+class SkClass
+  {
+  public:
+
+    struct MethodInitializerFuncId
+      {
+      uint32        m_method_name_id;
+      tSkMethodFunc m_method_p;
+      };
+
+    explicit SkClass(uint32 name_id) : m_name_id(name_id) {}
+
+    void          register_method_func_bulk(const MethodInitializerFuncId * bindings_p, uint32 count, eSkBindFlag flags);
+    tSkMethodFunc find_method_func(const char * name_p, bool is_class) const; // nullptr if not registered
+
+    uint32 m_name_id;
+    std::unordered_map<uint32, tSkMethodFunc> m_instance_methods;
+    std::unordered_map<uint32, tSkMethodFunc> m_class_methods;
+  };
+
+class SkBrain
+  {
+  public:
+
+    static SkClass * get_class(uint32 name_id); // Created on first use
+
+    static uint32 get_name_id(const char * name_p); // Same CRC32 the generator uses for name ids
+  };
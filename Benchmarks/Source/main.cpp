@@ -0,0 +1,264 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Times generated binding bodies against the stand-ins - ns and heap allocations per
+// call for every eSkTypeID shape (instance vs static method, getter vs setter), and
+// per element for batched bindings against their scalar counterparts
+//=======================================================================================
+
+#include "SkUEBenchObject.generated.hpp"
+#include "SkUEMarshal.generated.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace SkUE { void register_bindings(); }
+namespace SkUEBenchObject_BatchImpl { void register_bindings(); }
+
+//---------------------------------------------------------------------------------------
+// Every heap allocation goes through here so it can be counted
+
+namespace
+  {
+  uint64 s_heap_allocation_count = 0u;
+  }
+
+void * operator new(size_t size)
+  {
+  ++s_heap_allocation_count;
+  void * mem_p = std::malloc(size ? size : 1u);
+  if (!mem_p) throw std::bad_alloc();
+  return mem_p;
+  }
+
+void * operator new(size_t size, std::align_val_t alignment)
+  {
+  ++s_heap_allocation_count;
+  const size_t align = size_t(alignment);
+  void * mem_p = std::aligned_alloc(align, ((size ? size : 1u) + align - 1u) & ~(align - 1u));
+  if (!mem_p) throw std::bad_alloc();
+  return mem_p;
+  }
+
+void operator delete(void * mem_p) noexcept                                   { std::free(mem_p); }
+void operator delete(void * mem_p, size_t) noexcept                           { std::free(mem_p); }
+void operator delete(void * mem_p, std::align_val_t) noexcept                 { std::free(mem_p); }
+void operator delete(void * mem_p, size_t, std::align_val_t) noexcept         { std::free(mem_p); }
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+
+  struct Measurement
+    {
+    double m_ns;
+    double m_allocations; // Heap allocations
+    double m_instances; // Instances taken from the pool
+    };
+
+  // Runs invoke call_count times after one warm-up call (static lookups, instance pool) and
+  // returns the cost per element
+  template<typename _InvokeFunc>
+  Measurement measure(uint32 call_count, uint32 elements_per_call, const _InvokeFunc & invoke)
+    {
+    invoke();
+
+    const uint64 allocation_count = s_heap_allocation_count;
+    const uint64 instance_count = SkInstance::ms_new_instance_count;
+    const auto start_time = std::chrono::steady_clock::now();
+    for (uint32 i = 0u; i < call_count; ++i)
+      {
+      invoke();
+      }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+
+    const double element_count = double(call_count) * double(elements_per_call);
+    return { ns / element_count, double(s_heap_allocation_count - allocation_count) / element_count, double(SkInstance::ms_new_instance_count - instance_count) / element_count };
+    }
+
+  // Calls a binding like the script runtime does, releasing its result
+  FORCEINLINE void invoke_method(tSkMethodFunc method_p, SkInvokedMethod & scope)
+    {
+    SkInstance * result_p = nullptr;
+    method_p(&scope, &result_p);
+    if (result_p) result_p->dereference();
+    }
+
+  tSkMethodFunc find_method(const char * name_p, bool is_class)
+    {
+    tSkMethodFunc method_p = SkUEBenchObject::ms_class_p->find_method_func(name_p, is_class);
+    if (!method_p)
+      {
+      std::fprintf(stderr, "Error: No binding registered for BenchObject%s%s\n", is_class ? "." : "@", name_p);
+      std::exit(1);
+      }
+    return method_p;
+    }
+
+  void print_row(const char * shape_p, const char * binding_p, const char * kind_p, const Measurement & measurement)
+    {
+    std::printf("%-15s %-30s %-14s %10.1f %10.2f %10.2f\n", shape_p, binding_p, kind_p, measurement.m_ns, measurement.m_allocations, measurement.m_instances);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Bindings of one eSkTypeID shape and an argument value to pass to them
+
+  struct ShapeBindings
+    {
+    const char * m_shape_p;
+    const char * m_getter_p;
+    const char * m_setter_p;
+    const char * m_method_p;
+    const char * m_static_method_p;
+    SkInstance * m_value_p;
+    };
+
+  SkInstance * new_int_list(uint32 length)
+    {
+    SkInstance * list_p = SkList::new_instance(length);
+    for (uint32 i = 0u; i < length; ++i)
+      {
+      list_p->as<SkList>().append(*SkInteger::new_instance(int32(i)), false);
+      }
+    return list_p;
+    }
+
+  // Batched binding, its scalar counterpart and the argument list of each element if it takes one
+  struct BatchBindings
+    {
+    const char * m_batch_p;
+    const char * m_scalar_p;
+    SkInstance * m_values_p;
+    };
+
+  template<class _BindingClass, typename _DataType>
+  SkInstance * new_list(uint32 length, const _DataType & value)
+    {
+    SkInstance * list_p = SkList::new_instance(length);
+    for (uint32 i = 0u; i < length; ++i)
+      {
+      list_p->as<SkList>().append(*_BindingClass::new_instance(value), false);
+      }
+    return list_p;
+    }
+
+  } // namespace
+
+//---------------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+  {
+  const uint32 call_count = (argc > 1) ? uint32(std::strtoul(argv[1], nullptr, 10)) : 200000u;
+  const uint32 receiver_count = 256u;
+  if (argc > 2 || call_count == 0u)
+    {
+    std::fprintf(stderr, "Usage: SkookumScriptBindingBenchmarks [calls per binding, default 200000]\n");
+    return 2;
+    }
+
+  SkUE::register_bindings();
+  SkUEBenchObject_BatchImpl::register_bindings();
+
+  // Non-empty values so getters copy something
+  UBenchObject * object_p = NewObject<UBenchObject>();
+  object_p->StringValue = FString(TEXT("Benchmark property"));
+  object_p->ClassValue = UBenchObject::StaticClass();
+  object_p->ObjectValue = object_p;
+  for (int32 i = 0; i < 8; ++i)
+    {
+    object_p->ListValue.Add(i);
+    }
+  SkInstance * this_p = SkUEBenchObject::new_instance(object_p);
+
+  // Per shape
+  const ShapeBindings shapes[] =
+    {
+      { "Integer",        "int_value",             "int_value_set",             "echo_int",             "static_echo_int",             SkInteger::new_instance(42) },
+      { "Real",           "real_value",            "real_value_set",            "echo_real",            "static_echo_real",            SkReal::new_instance(1.5f) },
+      { "Boolean",        "bool_value?",           "bool_value_set",            "echo_bool",            "static_echo_bool",            SkBoolean::new_instance(true) },
+      { "String",         "string_value",          "string_value_set",          "echo_string",          "static_echo_string",          SkString::new_instance(AString("Benchmark argument", 18u)) },
+      { "Name",           "name_value",            "name_value_set",            "echo_name",            "static_echo_name",            SkUEName::new_instance(FName(TEXT("BenchmarkName"))) },
+      { "Vector2",        "vector_2value",         "vector_2value_set",         "echo_vector_2",        "static_echo_vector_2",        SkVector2::new_instance(FVector2D(1.0f, 2.0f)) },
+      { "Vector3",        "vector_3value",         "vector_3value_set",         "echo_vector_3",        "static_echo_vector_3",        SkVector3::new_instance(FVector(1.0f, 2.0f, 3.0f)) },
+      { "Vector4",        "vector_4value",         "vector_4value_set",         "echo_vector_4",        "static_echo_vector_4",        SkVector4::new_instance(FVector4(1.0f, 2.0f, 3.0f, 4.0f)) },
+      { "Rotation",       "rotation_value",        "rotation_value_set",        "echo_rotation",        "static_echo_rotation",        SkRotation::new_instance(FQuat(0.0f, 0.0f, 0.0f, 1.0f)) },
+      { "RotationAngles", "rotation_angles_value", "rotation_angles_value_set", "echo_rotation_angles", "static_echo_rotation_angles", SkRotationAngles::new_instance(FRotator(10.0f, 20.0f, 30.0f)) },
+      { "Transform",      "transform_value",       "transform_value_set",       "echo_transform",       "static_echo_transform",       SkTransform::new_instance(FTransform()) },
+      { "Color",          "color_value",           "color_value_set",           "echo_color",           "static_echo_color",           SkColor::new_instance(FLinearColor(1.0f, 0.5f, 0.25f, 1.0f)) },
+      { "UClass",         "class_value",           "class_value_set",           "echo_class",           "static_echo_class",           SkUEEntityClass::new_instance(UBenchObject::StaticClass()) },
+      { "UObject",        "object_value",          "object_value_set",          "echo_object",          "static_echo_object",          SkUEEntity::new_instance(object_p) },
+      { "List",           "list_value",            "list_value_set",            "echo_list",            "static_echo_list",            new_int_list(8u) },
+    };
+
+  std::printf("allocs = heap allocations, instances = instances taken from the pool - both per call or element\n\n");
+  std::printf("Generated bindings, %u calls each\n\n", call_count);
+  std::printf("%-15s %-30s %-14s %10s %10s %10s\n", "Shape", "Binding", "Kind", "ns/call", "allocs", "instances");
+  for (const ShapeBindings & shape : shapes)
+    {
+    SkInvokedMethod scope(this_p, &shape.m_value_p);
+
+    const struct { const char * m_name_p; const char * m_kind_p; bool m_is_class; } bindings[] =
+      {
+        { shape.m_getter_p,        "getter",        false },
+        { shape.m_setter_p,        "setter",        false },
+        { shape.m_method_p,        "method",        false },
+        { shape.m_static_method_p, "static method", true },
+      };
+    for (auto & binding : bindings)
+      {
+      tSkMethodFunc method_p = find_method(binding.m_name_p, binding.m_is_class);
+      print_row(shape.m_shape_p, binding.m_name_p, binding.m_kind_p, measure(call_count, 1u, [&]() { invoke_method(method_p, scope); }));
+      }
+    }
+
+  // Batched vs scalar, per element
+  std::vector<UBenchObject *> receivers;
+  SkInstance * receivers_p = SkList::new_instance(receiver_count);
+  for (uint32 i = 0u; i < receiver_count; ++i)
+    {
+    receivers.push_back(NewObject<UBenchObject>());
+    receivers_p->as<SkList>().append(*SkUEBenchObject::new_instance(receivers.back()), false);
+    }
+  SkInstance ** receiver_instances_pp = receivers_p->as<SkList>().get_instances().get_array();
+
+  const BatchBindings batches[] =
+    {
+      { "echo_real_batch",               "echo_real",           new_list<SkReal>(receiver_count, 1.5f) },
+      { "echo_vector_3_batch",           "echo_vector_3",       new_list<SkVector3>(receiver_count, FVector(1.0f, 2.0f, 3.0f)) },
+      { "real_value_batch",              "real_value",          nullptr },
+      { "real_value_set_batch",          "real_value_set",      new_list<SkReal>(receiver_count, 1.5f) },
+      { "vector_3value_batch",           "vector_3value",       nullptr },
+      { "vector_3value_set_batch",       "vector_3value_set",   new_list<SkVector3>(receiver_count, FVector(1.0f, 2.0f, 3.0f)) },
+      { "transform_value_batch",         "transform_value",     nullptr },
+      { "transform_value_set_batch",     "transform_value_set", new_list<SkTransform>(receiver_count, FTransform()) },
+    };
+
+  const uint32 batch_call_count = (call_count + receiver_count - 1u) / receiver_count;
+  std::printf("\nBatched bindings over %u receivers vs their scalar counterparts, %u calls each\n\n", receiver_count, batch_call_count);
+  std::printf("%-15s %-30s %-14s %10s %10s %10s\n", "Variant", "Binding", "", "ns/elem", "allocs", "instances");
+  for (const BatchBindings & batch : batches)
+    {
+    tSkMethodFunc scalar_method_p = find_method(batch.m_scalar_p, false);
+    SkInstance ** values_pp = batch.m_values_p ? batch.m_values_p->as<SkList>().get_instances().get_array() : nullptr;
+    print_row("scalar", batch.m_scalar_p, "", measure(batch_call_count, receiver_count, [&]()
+      {
+      for (uint32 i = 0u; i < receiver_count; ++i)
+        {
+        SkInvokedMethod scope(receiver_instances_pp[i], values_pp ? &values_pp[i] : nullptr);
+        invoke_method(scalar_method_p, scope);
+        }
+      }));
+
+    tSkMethodFunc batch_method_p = find_method(batch.m_batch_p, true);
+    SkInstance * const batch_args[] = { receivers_p, batch.m_values_p };
+    SkInvokedMethod batch_scope(nullptr, batch_args);
+    print_row("batch", batch.m_batch_p, "", measure(batch_call_count, receiver_count, [&]() { invoke_method(batch_method_p, batch_scope); }));
+    }
+
+  return 0;
+  }
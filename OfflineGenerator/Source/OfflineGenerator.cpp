@@ -0,0 +1,1622 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Regenerates script and binding files from a reflection snapshot, without UHT
+//=======================================================================================
+
+#include "OfflineGenerator.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <stdexcept>
+
+using namespace SkReflection;
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Same as FString::Printf()
+  std::string format(const char * format_p, ...)
+    {
+    va_list args;
+    va_start(args, format_p);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int length = vsnprintf(nullptr, 0, format_p, args_copy);
+    va_end(args_copy);
+    std::string result(size_t(std::max(length, 0)), '\0');
+    vsnprintf(&result[0], result.size() + 1, format_p, args);
+    va_end(args);
+    return result;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Same as FString::operator / ()
+  std::string path_join(const std::string & path, const std::string & name)
+    {
+    if (path.empty() || path.back() == '/' || path.back() == '\\')
+      {
+      return path + name;
+      }
+    return path + '/' + name;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Same as FString::Replace()
+  std::string replace_all(std::string text, const std::string & from, const std::string & to)
+    {
+    for (size_t pos = text.find(from); pos != std::string::npos; pos = text.find(from, pos + to.length()))
+      {
+      text.replace(pos, from.length(), to);
+      }
+    return text;
+    }
+
+  //---------------------------------------------------------------------------------------
+  bool starts_with(const std::string & text, const char * prefix_p)
+    {
+    return text.compare(0, std::strlen(prefix_p), prefix_p) == 0;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // FString comparison is case insensitive
+  bool equals_ignore_case(const std::string & a, const std::string & b)
+    {
+    return a.length() == b.length()
+      && std::equal(a.begin(), a.end(), b.begin(), [](char ca, char cb) { return std::tolower((unsigned char)ca) == std::tolower((unsigned char)cb); });
+    }
+
+  //---------------------------------------------------------------------------------------
+  std::vector<std::string> split_path(const std::string & path)
+    {
+    std::vector<std::string> components;
+    std::string component;
+    for (char c : path)
+      {
+      if (c == '/' || c == '\\')
+        {
+        if (!component.empty()) components.push_back(component);
+        component.clear();
+        }
+      else
+        {
+        component += c;
+        }
+      }
+    if (!component.empty()) components.push_back(component);
+    return components;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Same as FPaths::MakePathRelativeTo() - relative_to is taken as a file name, so only its folder counts
+  std::string make_path_relative_to(const std::string & path, const std::string & relative_to)
+    {
+    std::vector<std::string> target = split_path(path);
+    std::vector<std::string> source = split_path(relative_to);
+    if (!source.empty())
+      {
+      source.pop_back();
+      }
+
+    // Different drives can't be made relative
+    if (!target.empty() && !source.empty()
+      && target[0].length() > 1 && target[0][1] == ':'
+      && source[0].length() > 1 && source[0][1] == ':'
+      && std::toupper((unsigned char)target[0][0]) != std::toupper((unsigned char)source[0][0]))
+      {
+      return path;
+      }
+
+    size_t common = 0;
+    while (common < target.size() && common < source.size() && equals_ignore_case(target[common], source[common]))
+      {
+      ++common;
+      }
+
+    std::string result;
+    for (size_t i = common; i < source.size(); ++i)
+      {
+      result += "../";
+      }
+    for (size_t i = common; i < target.size(); ++i)
+      {
+      result += target[i];
+      if (i + 1 < target.size()) result += '/';
+      }
+    return result;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Same as FCrc::MemCrc32()
+  uint32_t mem_crc32(const void * data_p, size_t length)
+    {
+    static struct CrcTable
+      {
+      CrcTable()
+        {
+        for (uint32_t i = 0; i < 256; ++i)
+          {
+          uint32_t crc = i;
+          for (int bit = 0; bit < 8; ++bit)
+            {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320u : (crc >> 1);
+            }
+          m_entries[i] = crc;
+          }
+        }
+
+      uint32_t m_entries[256];
+      } table;
+
+    uint32_t crc = ~0u;
+    const uint8_t * bytes_p = static_cast<const uint8_t *>(data_p);
+    for (size_t i = 0; i < length; ++i)
+      {
+      crc = (crc >> 8) ^ table.m_entries[(crc ^ bytes_p[i]) & 0xff];
+      }
+    return ~crc;
+    }
+
+  //---------------------------------------------------------------------------------------
+  std::string normalize_path(const std::string & path)
+    {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+    }
+
+  //---------------------------------------------------------------------------------------
+  bool load_text_file(const std::string & file_path, std::string * text_p)
+    {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file)
+      {
+      return false;
+      }
+    text_p->assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+    }
+
+  } // namespace
+
+//=======================================================================================
+// Data
+//=======================================================================================
+
+const char * const SkOfflineGenerator::ms_sk_type_id_names[SkOfflineGenerator::SkTypeID__Count] =
+  {
+  "nil",
+  "Integer",
+  "Real",
+  "Boolean",
+  "String",
+  "Name",
+  "Vector2",
+  "Vector3",
+  "Vector4",
+  "Rotation",
+  "RotationAngles",
+  "Transform",
+  "Color",
+  "EntityClass",  // UClass
+  "Entity",       // UObject
+  "UStruct",      // Any other USTRUCT - not generated by the offline path
+  "List",         // TArray
+  };
+
+const char * const SkOfflineGenerator::ms_sk_type_id_binding_class_names[SkOfflineGenerator::SkTypeID__Count] =
+  {
+  "",
+  "SkInteger",
+  "SkReal",
+  "SkBoolean",
+  "SkString",
+  "SkUEName",
+  "SkVector2",
+  "SkVector3",
+  "SkVector4",
+  "SkRotation",
+  "SkRotationAngles",
+  "SkTransform",
+  "SkColor",
+  "SkUEEntityClass",
+  "SkUEEntity",       // Generic binding - get_skookum_binding_class_name() returns the specific one
+  "",
+  "SkList",           // Generic binding - get_skookum_binding_class_name() returns SkUEList<> with the element type
+  };
+
+const char * const SkOfflineGenerator::ms_reserved_keywords[] =
+  {
+  "branch",
+  "case",
+  "divert",
+  "else",
+  "exit",
+  "false",
+  "fork",
+  "if",
+  "loop",
+  "nil",
+  "race",
+  "rush",
+  "skip",
+  "sync",
+  "this",
+  "this_class",
+  "this_code",
+  "true",
+  "unless",
+  "when",
+
+  // Boolean word operators
+  "and",
+  "nand",
+  "nor",
+  "not",
+  "nxor",
+  "or",
+  "xor",
+
+  // C++ Reserved Words to watch for
+  "break",
+  "continue",
+  "default",
+  "do",
+  "for",
+  "return",
+  "switch",
+  "while",
+  };
+
+//=======================================================================================
+// Public interface
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+SkOfflineGenerator::SkOfflineGenerator(const std::string & binding_code_path, const std::string & runtime_plugin_root_path)
+  : m_binding_code_path(binding_code_path)
+  , m_scripts_path_depth(4) // Set to sensible default in case we don't find it in the ini file
+  , m_runtime_plugin_root_path(runtime_plugin_root_path)
+  , m_model_p(nullptr)
+  , m_written_file_count(0)
+  {
+  m_scripts_path = normalize_path(std::filesystem::absolute(path_join(runtime_plugin_root_path, "../../Scripts/Engine-Generated")).string());
+
+  // Try to figure the path depth from ini file
+  std::string ini_file_text;
+  if (load_text_file(path_join(m_scripts_path, "../Skookum-project-default.ini"), &ini_file_text))
+    {
+    std::smatch match;
+    if (std::regex_search(ini_file_text, match, std::regex("Overlay[0-9]+=Engine-Generated\\|.*?\\|([0-9]+)")))
+      {
+      int32_t path_depth = std::atoi(match[1].str().c_str());
+      if (path_depth > 0)
+        {
+        m_scripts_path_depth = path_depth;
+        }
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::load_settings(const std::string & engine_ini_file_path)
+  {
+  // Options changing the generated code - this path only reproduces the output with all of them off
+  static const char * const unsupported_bool_keys[] =
+    {
+    "UseDescriptorTables",
+    "GenerateBatchBindings",
+    "GenerateEventBindings",
+    "GenerateCoroutines",
+    "ReturnOutParams",
+    "InstrumentBindings",
+    "GenerateShippingProfile",
+    "CacheObjectWrappers",
+    "GenerateThreadSafeBindings",
+    "GenerateStructBindings",
+    "WriteSignatureDatabase",
+    };
+  static const char * const unsupported_array_keys[] =
+    {
+    "PropertySnapshots",
+    "MemoizedFunctions",
+    };
+
+  m_skip_classes.clear();
+
+  std::string ini_file_text;
+  if (!load_text_file(engine_ini_file_path, &ini_file_text))
+    {
+    throw std::runtime_error("Could not load ini file: " + engine_ini_file_path);
+    }
+
+  // Only [SkookumScriptGenerator] matters, as Key=Value or +Key=Value lines
+  bool is_in_section = false;
+  std::string line;
+  for (size_t line_begin = 0; line_begin < ini_file_text.length();)
+    {
+    size_t line_end = ini_file_text.find('\n', line_begin);
+    if (line_end == std::string::npos) line_end = ini_file_text.length();
+    line = ini_file_text.substr(line_begin, line_end - line_begin);
+    line_begin = line_end + 1;
+    line.erase(line.find_last_not_of(" \t\r") + 1);
+    line.erase(0, line.find_first_not_of(" \t"));
+
+    if (line.empty() || line[0] == ';')
+      {
+      continue;
+      }
+    if (line[0] == '[')
+      {
+      is_in_section = (line == "[SkookumScriptGenerator]");
+      continue;
+      }
+    size_t equal_pos = line.find('=');
+    if (!is_in_section || equal_pos == std::string::npos)
+      {
+      continue;
+      }
+
+    std::string key = line.substr(0, equal_pos);
+    std::string value = line.substr(equal_pos + 1);
+    if (!key.empty() && (key[0] == '+' || key[0] == '.'))
+      {
+      key.erase(0, 1);
+      }
+
+    if (key == "SkipClasses")
+      {
+      m_skip_classes.push_back(value);
+      continue;
+      }
+
+    // Same as FCString::ToBool()
+    const bool is_true = equals_ignore_case(value, "True") || equals_ignore_case(value, "Yes") || equals_ignore_case(value, "On") || std::atoi(value.c_str()) != 0;
+    for (auto key_p : unsupported_bool_keys)
+      {
+      if (key == key_p && is_true)
+        {
+        throw std::runtime_error(format("%s is not supported by the offline generator - run UHT instead.", key_p));
+        }
+      }
+    for (auto key_p : unsupported_array_keys)
+      {
+      if (key == key_p && !value.empty())
+        {
+        throw std::runtime_error(format("%s is not supported by the offline generator - run UHT instead.", key_p));
+        }
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate(const Model & model)
+  {
+  m_model_p = &model;
+  m_all_header_file_names.clear();
+  m_all_binding_file_names.clear();
+  m_exported_classes.clear();
+  m_exported_class_names.clear();
+  m_extra_classes.clear();
+  m_used_class_names.clear();
+  m_script_file_paths.clear();
+  m_written_file_count = 0;
+
+  // Same filters as FSkookumScriptGenerator::ExportClass(), in the order UHT handed the classes over
+  for (auto & class_info : model.m_classes)
+    {
+    // $Revisit MBreyer - (for now) skip and forget classes coming from engine plugins
+    if (class_info.m_source_header_file_name.find("Engine/Plugins") != std::string::npos
+      || class_info.m_source_header_file_name.find("Engine\\Plugins") != std::string::npos)
+      {
+      continue;
+      }
+
+    if (!can_export_class(class_info))
+      {
+      if (std::find(m_extra_classes.begin(), m_extra_classes.end(), &class_info) == m_extra_classes.end())
+        {
+        m_extra_classes.push_back(&class_info);
+        }
+      continue;
+      }
+
+    generate_class(class_info);
+    }
+
+  // Generate any classes that have been used but not exported yet
+  for (auto extra_class_p : m_extra_classes)
+    {
+    if (m_used_class_names.count(extra_class_p->m_name) && !m_exported_class_names.count(extra_class_p->m_name))
+      {
+      generate_class(*extra_class_p);
+      }
+    }
+
+  generate_marshal_traits_file();
+  generate_master_binding_file();
+  delete_stale_script_files();
+
+  m_model_p = nullptr;
+  }
+
+//=======================================================================================
+// Generation
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_class(const Class & class_info)
+  {
+  m_exported_classes.push_back(&class_info);
+  m_exported_class_names.insert(class_info.m_name);
+
+  // Generate script files
+  generate_class_script_files(class_info);
+
+  // Generate binding code files
+  generate_class_header_file(class_info);
+  generate_class_binding_file(class_info);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_class_script_files(const Class & class_info)
+  {
+  // Create class meta file:
+  save_script_file(std::string(), path_join(get_skookum_class_path(class_info), "!Class.sk-meta"));
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_class_header_file(const Class & class_info)
+  {
+  const std::string class_header_file_name = format("SkUE%s.generated.hpp", get_skookum_class_name(class_info).c_str());
+  m_all_header_file_names.push_back(class_header_file_name);
+
+  std::string skookum_class_name = get_skookum_class_name(class_info);
+  std::string cpp_class_name = get_cpp_class_name(class_info);
+
+  std::string generated_code;
+
+  generated_code += "#pragma once\r\n\r\n";
+  generated_code += "#include <Bindings/SkUEClassBinding.hpp>\r\n";
+
+  // if not defined let's hope it is already known when the compiler gets here
+  if (!class_info.m_source_header_file_name.empty())
+    {
+    std::string relative_path = make_path_relative_to(class_info.m_source_header_file_name, m_runtime_plugin_root_path);
+    generated_code += format("#include <%s>\r\n\r\n", relative_path.c_str());
+    }
+  else
+    {
+    generated_code += format("// Note: Include path for %s was unknown at code generation time, so hopefully the class is already known when compilation gets here\r\n\r\n", cpp_class_name.c_str());
+    }
+
+  // The cast flags say the same, but their values changed between engine versions - the super chain doesn't
+  generated_code += format("class SkUE%s : public SkUEClassBinding%s<SkUE%s, %s>\r\n  {\r\n",
+    skookum_class_name.c_str(),
+    class_info.is_child_of("Actor") ? "Actor" : "Entity",
+    skookum_class_name.c_str(),
+    cpp_class_name.c_str());
+
+  generated_code += "  public:\r\n";
+  generated_code += "    static void register_bindings();\r\n";
+  generated_code += "  };\r\n";
+
+  save_file_if_changed(generated_code, path_join(m_binding_code_path, class_header_file_name));
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_class_binding_file(const Class & class_info)
+  {
+  const std::string skookum_class_name = get_skookum_class_name(class_info);
+  const std::string class_binding_file_name = format("SkUE%s.generated.inl", skookum_class_name.c_str());
+  m_all_binding_file_names.push_back(class_binding_file_name);
+
+  const std::string class_name_cpp = get_cpp_class_name(class_info);
+
+  enum eScope { Scope_instance, Scope_class }; // 0 = instance, 1 = static bindings
+  std::vector<MethodBinding> bindings[2]; // eScope
+  MethodBinding binding;
+  auto is_bound = [&bindings](const MethodBinding & binding, int scope_count)
+    {
+    for (int scope = 0; scope < scope_count; ++scope)
+      {
+      if (std::find(bindings[scope].begin(), bindings[scope].end(), binding) != bindings[scope].end()) return true;
+      }
+    return false;
+    };
+
+  // Static methods get invoked on the class default object which is looked up once at registration time
+  bool has_static_methods = false;
+  for (auto & function : class_info.m_functions)
+    {
+    has_static_methods = has_static_methods || (function.has_any_function_flags(FUNC_Static) && can_export_method(class_info, function));
+    }
+
+  std::string generated_code;
+  generated_code += format("\r\nnamespace SkUE%s_Impl\r\n  {\r\n\r\n", skookum_class_name.c_str());
+
+  if (has_static_methods)
+    {
+    generated_code += "  static UObject * default_object_p = nullptr; // Class default object, set in register_bindings()\r\n\r\n";
+    }
+
+  // Export all functions
+  for (auto & function : class_info.m_functions)
+    {
+    if (can_export_method(class_info, function))
+      {
+      binding.make_method(function);
+      if (!is_bound(binding, 2)) // If method with this name already bound, assume it does the same thing and skip
+        {
+        generated_code += generate_method(class_name_cpp, class_info, function, binding);
+        bindings[function.has_any_function_flags(FUNC_Static) ? Scope_class : Scope_instance].push_back(binding);
+        }
+      }
+    }
+
+  // Export properties that are owned by this class
+  for (auto & property : class_info.m_properties)
+    {
+    if (can_export_property(class_info, property))
+      {
+      binding.make_property_getter(property);
+      if (!is_bound(binding, 1))
+        { // Only generate property accessor if not covered by a method already
+        generated_code += generate_property_getter(class_name_cpp, class_info, property, binding);
+        bindings[Scope_instance].push_back(binding);
+        }
+
+      if (property.has_any_property_flags(CPF_Edit))
+        {
+        binding.make_property_setter(property);
+        if (!is_bound(binding, 1))
+          { // Only generate property accessor if not covered by a method already
+          generated_code += generate_property_setter(class_name_cpp, class_info, property, binding);
+          bindings[Scope_instance].push_back(binding);
+          }
+        }
+      }
+    }
+
+  // Binding array
+  for (int scope = 0; scope < 2; ++scope)
+    {
+    if (!bindings[scope].empty())
+      {
+      generated_code += format("  static const SkClass::MethodInitializerFuncId methods_%c[] =\r\n    {\r\n", scope ? 'c' : 'i');
+      for (auto & binding : bindings[scope])
+        {
+        generated_code += format("      { 0x%08x, mthd%s_%s },\r\n", get_skookum_string_crc(binding.m_script_name), scope ? "c" : "", binding.m_code_name.c_str());
+        }
+      generated_code += "    };\r\n\r\n";
+      }
+    }
+
+  // Close namespace
+  generated_code += format("  } // SkUE%s_Impl\r\n\r\n", skookum_class_name.c_str());
+
+  // Register bindings function
+  generated_code += format("void SkUE%s::register_bindings()\r\n  {\r\n", skookum_class_name.c_str());
+
+  generated_code += format("  tBindingBase::register_bindings(0x%08x); // \"%s\"\r\n\r\n", get_skookum_string_crc(skookum_class_name), skookum_class_name.c_str());
+
+  // Only set ms_uclass_p if DLL exported
+  if (does_class_have_static_class(class_info))
+    {
+    generated_code += format("  ms_uclass_p = %s::StaticClass();\r\n", class_name_cpp.c_str());
+    }
+  else
+    {
+    generated_code += "  // ms_uclass_p has already been resolved by SkUE::resolve_uclasses()\r\n";
+    }
+
+  if (has_static_methods)
+    {
+    generated_code += format("  SkUE%s_Impl::default_object_p = GetMutableDefault<UObject>(ms_uclass_p);\r\n", skookum_class_name.c_str());
+    }
+
+  for (int scope = 0; scope < 2; ++scope)
+    {
+    if (!bindings[scope].empty())
+      {
+      generated_code += format("  ms_class_p->register_method_func_bulk(SkUE%s_Impl::methods_%c, %d, %s);\r\n", skookum_class_name.c_str(), scope ? 'c' : 'i', int(bindings[scope].size()), scope ? "SkBindFlag_class_no_rebind" : "SkBindFlag_instance_no_rebind");
+      }
+    }
+  generated_code += "  }\r\n";
+
+  save_file_if_changed(generated_code, path_join(m_binding_code_path, class_binding_file_name));
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_method(const std::string & class_name_cpp, const Class & class_info, const Function & function, const MethodBinding & binding)
+  {
+  // Generate script file
+  generate_method_script_file(class_info, function, binding.m_script_name);
+
+  // Generate binding code
+  return generate_method_binding_code(class_name_cpp, class_info, function, binding);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_method_script_file(const Class & class_info, const Function & function, const std::string & script_function_name)
+  {
+  // Generate function content
+  std::string function_body;
+  if (function.has_params_or_return_value())
+    {
+    function_body += "(";
+
+    std::string separator;
+    std::string return_type_name;
+    for (auto & param : function.m_params)
+      {
+      if (param.has_any_property_flags(CPF_ReturnParm))
+        {
+        return_type_name = " " + get_skookum_property_type_name(param);
+        }
+      else
+        {
+        function_body += separator + get_skookum_property_type_name(param) + " " + skookify_var_name(param.m_name);
+        separator = ", ";
+        }
+      }
+
+    function_body += ")" + return_type_name + "\n";
+    }
+  else
+    {
+    function_body = "()\n";
+    }
+
+  // Create script file - exported methods are always owned by the class they are exported with
+  save_script_file(function_body, get_skookum_method_path(class_info, script_function_name, function.has_any_function_flags(FUNC_Static)));
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_method_binding_code(const std::string & class_name_cpp, const Class & class_info, const Function & function, const MethodBinding & binding)
+  {
+  bool is_static = function.has_any_function_flags(FUNC_Static);
+
+  std::string function_body;
+  function_body += format("    %s\r\n", generate_this_pointer_initialization(class_name_cpp, class_info, is_static).c_str());
+
+  std::string params;
+
+  if (function.has_params_or_return_value())
+    {
+    params += "    struct FDispatchParams\r\n      {\r\n";
+
+    for (auto & param : function.m_params)
+      {
+      params += format("      %s %s;\r\n", param.m_cpp_type_name.c_str(), param.m_name.c_str());
+      }
+    params += "      } params;\r\n";
+    int32_t param_index = 0;
+    for (auto & param : function.m_params)
+      {
+      params += format("    params.%s = %s;\r\n", param.m_name.c_str(), generate_method_parameter_expression(param, param_index).c_str());
+      if (!param.has_any_property_flags(CPF_ReturnParm))
+        {
+        ++param_index;
+        }
+      }
+    }
+
+  params += format("    %s\r\n", generate_this_pointer_assert(format("Tried to invoke method %s@%s but the %s is null.", get_skookum_class_name(class_info).c_str(), binding.m_script_name.c_str(), get_skookum_class_name(class_info).c_str())).c_str());
+  params += "    if (this_p)\r\n      {\r\n";
+  params += format("      static UFunction * function_p = this_p->FindFunctionChecked(TEXT(\"%s\"));\r\n", function.m_name.c_str());
+
+  if (function.has_params_or_return_value())
+    {
+    params += "      check(function_p->ParmsSize <= sizeof(FDispatchParams));\r\n";
+    params += "      this_p->ProcessEvent(function_p, &params);\r\n";
+    }
+  else
+    {
+    params += "      this_p->ProcessEvent(function_p, nullptr);\r\n";
+    }
+  params += "      }\r\n";
+
+  function_body += params;
+
+  const Property * return_value_p = function.get_return_property();
+  if (return_value_p)
+    {
+    function_body += format("    %s\r\n", generate_return_value_passing(return_value_p, "params." + return_value_p->m_name).c_str());
+    }
+
+  std::string generated_code = format("  %s\r\n    {\r\n", generate_method_binding_declaration(binding.m_code_name, is_static).c_str());
+  generated_code += function_body;
+  generated_code += "    }\r\n\r\n";
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_property_getter(const std::string & class_name_cpp, const Class & class_info, const Property & property, const MethodBinding & binding)
+  {
+  // Generate script file
+  save_script_file("() " + get_skookum_property_type_name(property) + "\n", get_skookum_method_path(class_info, binding.m_script_name, false));
+
+  // Generate binding code
+  std::string generated_code;
+
+  std::string default_ctor_argument = generate_property_default_ctor_argument(property);
+  if (!default_ctor_argument.empty())
+    {
+    default_ctor_argument = "(" + default_ctor_argument + ")";
+    }
+
+  const char * property_type_name_cpp_p = property.m_cpp_type_name.c_str();
+  generated_code += format("  %s\r\n    {\r\n", generate_method_binding_declaration(binding.m_code_name, false).c_str());
+  generated_code += format("    %s\r\n", generate_this_pointer_initialization(class_name_cpp, class_info, false).c_str());
+  generated_code += format("    %s\r\n", generate_property_lookup(class_info, property).c_str());
+  const std::string this_pointer_assert = generate_this_pointer_assert(format("Tried to invoke method %s@%s but the %s is null.", get_skookum_class_name(class_info).c_str(), binding.m_script_name.c_str(), get_skookum_class_name(class_info).c_str()));
+  if (is_property_read_in_place(property))
+    {
+    // Arrays and structs are read in place rather than copied first - the only copy made is the one into the result instance
+    generated_code += format("    %s\r\n", this_pointer_assert.c_str());
+    generated_code += format("    static const %s empty_value%s;\r\n", property_type_name_cpp_p, default_ctor_argument.c_str());
+    generated_code += format("    const %s & property_value = this_p ? *property_p->ContainerPtrToValuePtr<%s>(this_p) : empty_value;\r\n", property_type_name_cpp_p, property_type_name_cpp_p);
+    }
+  else
+    {
+    generated_code += format("    %s property_value%s;\r\n", property_type_name_cpp_p, default_ctor_argument.c_str());
+    generated_code += format("    %s\r\n", this_pointer_assert.c_str());
+    generated_code += "    if (this_p)\r\n      {\r\n";
+    generated_code += "      property_p->CopyCompleteValue(&property_value, property_p->ContainerPtrToValuePtr<void>(this_p));\r\n";
+    generated_code += "      }\r\n";
+    }
+  generated_code += format("    %s\r\n", generate_return_value_passing(&property, "property_value").c_str());
+  generated_code += "    }\r\n\r\n";
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_property_setter(const std::string & class_name_cpp, const Class & class_info, const Property & property, const MethodBinding & binding)
+  {
+  // Generate script file
+  save_script_file("(" + get_skookum_property_type_name(property) + " " + skookify_var_name(property.m_name) + ")\n", path_join(get_skookum_class_path(class_info), binding.m_script_name + "().sk"));
+
+  // Generate binding code
+  std::string generated_code;
+
+  const char * property_type_name_cpp_p = property.m_cpp_type_name.c_str();
+  generated_code += format("  %s\r\n    {\r\n", generate_method_binding_declaration(binding.m_code_name, false).c_str());
+  generated_code += format("    %s\r\n", generate_this_pointer_initialization(class_name_cpp, class_info, false).c_str());
+  generated_code += format("    %s\r\n", generate_this_pointer_assert(format("Tried to invoke method %s@%s but the %s is null.", get_skookum_class_name(class_info).c_str(), binding.m_script_name.c_str(), get_skookum_class_name(class_info).c_str())).c_str());
+  generated_code += "    if (this_p)\r\n      {\r\n";
+  generated_code += format("      %s\r\n", generate_property_lookup(class_info, property).c_str());
+  generated_code += format("      %s property_value = %s;\r\n", property_type_name_cpp_p, generate_method_parameter_expression(property, 0).c_str());
+  if (get_skookum_property_type(property) == SkTypeID_List)
+    {
+    // Hand the freshly built array buffer over instead of copying it
+    generated_code += format("      *property_p->ContainerPtrToValuePtr<%s>(this_p) = MoveTemp(property_value);\r\n", property_type_name_cpp_p);
+    }
+  else
+    {
+    generated_code += "      property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &property_value);\r\n";
+    }
+  generated_code += "      }\r\n";
+  generated_code += "    }\r\n\r\n";
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_method_binding_declaration(const std::string & function_name, bool is_static)
+  {
+  return format("static void mthd%s_%s(SkInvokedMethod * scope_p, SkInstance ** result_pp)", is_static ? "c" : "", function_name.c_str());
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_this_pointer_initialization(const std::string & class_name_cpp, const Class & class_info, bool is_static)
+  {
+  if (is_static)
+    {
+    return format("%s * this_p = static_cast<%s *>(default_object_p);", class_name_cpp.c_str(), class_name_cpp.c_str());
+    }
+  return format("%s * this_p = scope_p->this_as<SkUE%s>();", class_name_cpp.c_str(), get_skookum_class_name(class_info).c_str());
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_this_pointer_assert(const std::string & message)
+  {
+  return format("SK_ASSERTX(this_p, \"%s\");", message.c_str());
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_property_lookup(const Class & class_info, const Property & property)
+  {
+  return format("static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUE%s::ms_uclass_p, TEXT(\"%s\"));", get_skookum_class_name(class_info).c_str(), property.m_name.c_str());
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_method_parameter_expression(const Property & param, int32_t param_index)
+  {
+  // Return values are only written by the function - just value-initialize them
+  if (!param.has_any_property_flags(CPF_ReturnParm))
+    {
+    if (get_skookum_property_type(param) == SkTypeID_None)
+      {
+      throw std::runtime_error("Unsupported function param type: " + param.m_property_class_name);
+      }
+
+    return format("SkMarshal<%s>::from_arg(scope_p, SkArg_%d)", get_skookum_binding_class_name(param).c_str(), param_index + 1);
+    }
+  else if (param.is_object_property_base())
+    {
+    return "nullptr";
+    }
+  else
+    {
+    return format("%s(%s)", param.m_cpp_type_name.c_str(), generate_property_default_ctor_argument(param).c_str());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_property_default_ctor_argument(const Property & param)
+  {
+  eSkTypeID type_id = get_skookum_property_type(param);
+  switch (type_id)
+    {
+    case SkTypeID_Integer:         return "0";
+    case SkTypeID_Real:            return "0.0f";
+    case SkTypeID_Boolean:         return "false";
+    case SkTypeID_String:
+    case SkTypeID_Name:
+    case SkTypeID_Transform:
+    case SkTypeID_UStruct:
+    case SkTypeID_List:            return "";
+    case SkTypeID_Vector2:
+    case SkTypeID_Vector3:
+    case SkTypeID_Vector4:
+    case SkTypeID_Rotation:
+    case SkTypeID_RotationAngles:
+    case SkTypeID_Color:           return "ForceInitToZero";
+    case SkTypeID_UClass:
+    case SkTypeID_UObject:         return "nullptr";
+    default:                       throw std::runtime_error("Unsupported property type: " + param.m_property_class_name);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::generate_return_value_passing(const Property * return_value_p, const std::string & return_value_name)
+  {
+  if (!return_value_p)
+    {
+    return std::string();
+    }
+
+  if (get_skookum_property_type(*return_value_p) == SkTypeID_None)
+    {
+    throw std::runtime_error("Unsupported return param type: " + return_value_p->m_property_class_name);
+    }
+
+  return format("if (result_pp) *result_pp = SkMarshal<%s>::to_result(%s);", get_skookum_binding_class_name(*return_value_p).c_str(), return_value_name.c_str());
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_master_binding_file()
+  {
+  std::string generated_code;
+
+  generated_code += "\r\n";
+
+  generated_code += "#include \"SkookumScript/SkClass.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkBrain.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkInvokedMethod.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkInteger.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkReal.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkBoolean.hpp\"\r\n";
+  generated_code += "#include \"SkookumScript/SkString.hpp\"\r\n";
+
+  generated_code += "\r\n";
+
+  // Include all headers
+  for (auto & header_file_name : m_all_header_file_names)
+    {
+    generated_code += format("#include \"%s\"\r\n", header_file_name.c_str());
+    }
+
+  generated_code += "\r\n";
+
+  // Include support code used by the bindings
+  generated_code += "#include \"SkUEMarshal.generated.hpp\"\r\n";
+
+  generated_code += "\r\n";
+
+  // Include all bindings
+  for (auto & binding_file_name : m_all_binding_file_names)
+    {
+    generated_code += format("#include \"%s\"\r\n", binding_file_name.c_str());
+    }
+
+  generated_code += "\r\nnamespace SkUE\r\n  {\r\n\r\n";
+
+  // Classes without StaticClass() must be found by name - do it for all of them in a single pass over all UClasses
+  std::vector<const Class *> unresolved_classes;
+  for (auto class_p : m_exported_classes)
+    {
+    if (!does_class_have_static_class(*class_p))
+      {
+      unresolved_classes.push_back(class_p);
+      }
+    }
+  if (!unresolved_classes.empty())
+    {
+    generated_code += "  static void resolve_uclasses()\r\n    {\r\n";
+    generated_code += format("    TMap<FName, UClass **> uclass_slots;\r\n    uclass_slots.Reserve(%d);\r\n", int(unresolved_classes.size()));
+    for (auto class_p : unresolved_classes)
+      {
+      generated_code += format("    uclass_slots.Add(FName(TEXT(\"%s\")), &SkUE%s::ms_uclass_p);\r\n", class_p->m_name.c_str(), get_skookum_class_name(*class_p).c_str());
+      }
+    generated_code += "    for (TObjectIterator<UClass> class_it; class_it && uclass_slots.Num(); ++class_it)\r\n      {\r\n";
+    generated_code += "      UClass ** slot_pp = uclass_slots.FindRef(class_it->GetFName());\r\n";
+    generated_code += "      if (slot_pp)\r\n        {\r\n";
+    generated_code += "        *slot_pp = *class_it;\r\n";
+    generated_code += "        uclass_slots.Remove(class_it->GetFName()); // First match wins, like FindObject()\r\n";
+    generated_code += "        }\r\n";
+    generated_code += "      }\r\n";
+    generated_code += "    }\r\n\r\n";
+    }
+
+  generated_code += "  void register_bindings()\r\n    {\r\n";
+  if (!unresolved_classes.empty())
+    {
+    generated_code += "    resolve_uclasses();\r\n\r\n";
+    }
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += format("    SkUE%s::register_bindings();\r\n", get_skookum_class_name(*class_p).c_str());
+    }
+  generated_code += format("\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reserve(%d);\r\n", int(m_exported_classes.size()));
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += format("    SkUEClassBindingHelper::ms_class_map_u2s.Add(SkUE%s::ms_uclass_p, SkUE%s::ms_class_p);\r\n", get_skookum_class_name(*class_p).c_str(), get_skookum_class_name(*class_p).c_str());
+    }
+  generated_code += format("\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reserve(%d);\r\n", int(m_exported_classes.size()));
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += format("    SkUEClassBindingHelper::ms_class_map_s2u.Add(SkUE%s::ms_class_p, SkUE%s::ms_uclass_p);\r\n", get_skookum_class_name(*class_p).c_str(), get_skookum_class_name(*class_p).c_str());
+    }
+  generated_code += "\r\n    }\r\n";
+
+  generated_code += "\r\n  } // SkUE\r\n";
+
+  save_file_if_changed(generated_code, path_join(m_binding_code_path, "SkUE.generated.inl"));
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::generate_marshal_traits_file()
+  {
+  std::string generated_code;
+
+  generated_code += "#pragma once\r\n\r\n";
+
+  generated_code += "#include \"SkookumScript/SkList.hpp\"\r\n\r\n";
+
+  generated_code += "// Conversion between script arguments/results and C++ values, one specialization per type\r\n";
+  generated_code += "// Default: The binding class already stores the C++ type\r\n";
+  generated_code += "template<class _BindingClass>\r\n";
+  generated_code += "struct SkMarshal\r\n  {\r\n";
+  generated_code += "  static FORCEINLINE auto from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) -> decltype(scope_p->get_arg<_BindingClass>(arg_idx)) { return scope_p->get_arg<_BindingClass>(arg_idx); }\r\n";
+  generated_code += "  static FORCEINLINE auto from_instance(SkInstance * instance_p) -> decltype(instance_p->as<_BindingClass>()) { return instance_p->as<_BindingClass>(); }\r\n";
+  generated_code += "  template<typename _CppType>\r\n";
+  generated_code += "  static FORCEINLINE SkInstance * to_result(const _CppType & value) { return _BindingClass::new_instance(value); }\r\n";
+  generated_code += "  };\r\n\r\n";
+
+  generated_code += "template<>\r\n";
+  generated_code += "struct SkMarshal<SkInteger>\r\n  {\r\n";
+  generated_code += "  static FORCEINLINE int32 from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return int32(scope_p->get_arg<SkInteger>(arg_idx)); }\r\n";
+  generated_code += "  static FORCEINLINE int32 from_instance(SkInstance * instance_p) { return int32(instance_p->as<SkInteger>()); }\r\n";
+  generated_code += "  static FORCEINLINE SkInstance * to_result(int32 value) { return SkInteger::new_instance(value); }\r\n";
+  generated_code += "  };\r\n\r\n";
+
+  generated_code += "template<>\r\n";
+  generated_code += "struct SkMarshal<SkReal>\r\n  {\r\n";
+  generated_code += "  static FORCEINLINE float from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return float(scope_p->get_arg<SkReal>(arg_idx)); }\r\n";
+  generated_code += "  static FORCEINLINE float from_instance(SkInstance * instance_p) { return float(instance_p->as<SkReal>()); }\r\n";
+  generated_code += "  static FORCEINLINE SkInstance * to_result(float value) { return SkReal::new_instance(value); }\r\n";
+  generated_code += "  };\r\n\r\n";
+
+  generated_code += "template<>\r\n";
+  generated_code += "struct SkMarshal<SkString>\r\n  {\r\n";
+  generated_code += "  static FORCEINLINE FString from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return FString(scope_p->get_arg<SkString>(arg_idx).as_cstr()); } // $revisit MBreyer - Avoid copy here\r\n";
+  generated_code += "  static FORCEINLINE FString from_instance(SkInstance * instance_p) { return FString(instance_p->as<SkString>().as_cstr()); }\r\n";
+  generated_code += "  static FORCEINLINE SkInstance * to_result(const FString & value) { return SkString::new_instance(AString(*value, value.Len())); } // $revisit MBreyer - Avoid copy here\r\n";
+  generated_code += "  };\r\n\r\n";
+
+  generated_code += "// Tag type selecting conversion between a List and a TArray<_ElemType> whose elements are marshaled via _ElemBindingClass\r\n";
+  generated_code += "template<class _ElemBindingClass, typename _ElemType>\r\n";
+  generated_code += "struct SkUEList {};\r\n\r\n";
+
+  generated_code += "template<class _ElemBindingClass, typename _ElemType>\r\n";
+  generated_code += "struct SkMarshal<SkUEList<_ElemBindingClass, _ElemType>>\r\n  {\r\n";
+  generated_code += "  // Fills the array with a single allocation and returns it by value (moved, not copied)\r\n";
+  generated_code += "  static TArray<_ElemType> from_list(const SkInstanceList & list)\r\n    {\r\n";
+  generated_code += "    const APArray<SkInstance> & instances = list.get_instances();\r\n";
+  generated_code += "    const uint32 length = instances.get_length();\r\n";
+  generated_code += "    SkInstance ** instances_pp = instances.get_array();\r\n";
+  generated_code += "    TArray<_ElemType> values;\r\n";
+  generated_code += "    values.Reserve(length);\r\n";
+  generated_code += "    for (uint32 i = 0; i < length; ++i)\r\n      {\r\n";
+  generated_code += "      values.Add(SkMarshal<_ElemBindingClass>::from_instance(instances_pp[i]));\r\n";
+  generated_code += "      }\r\n";
+  generated_code += "    return values;\r\n";
+  generated_code += "    }\r\n\r\n";
+  generated_code += "  static FORCEINLINE TArray<_ElemType> from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return from_list(scope_p->get_arg<SkList>(arg_idx)); }\r\n";
+  generated_code += "  static FORCEINLINE TArray<_ElemType> from_instance(SkInstance * instance_p) { return from_list(instance_p->as<SkList>()); }\r\n\r\n";
+  generated_code += "  // Reads the elements in place - callers pass the native array directly instead of a copy\r\n";
+  generated_code += "  static SkInstance * to_result(const TArray<_ElemType> & values)\r\n    {\r\n";
+  generated_code += "    SkInstance * list_p = SkList::new_instance(values.Num());\r\n";
+  generated_code += "    SkInstanceList & list = list_p->as<SkList>();\r\n";
+  generated_code += "    for (const _ElemType & value : values)\r\n      {\r\n";
+  generated_code += "      list.append(*SkMarshal<_ElemBindingClass>::to_result(value), false); // Take over the reference of the new instance\r\n";
+  generated_code += "      }\r\n";
+  generated_code += "    return list_p;\r\n";
+  generated_code += "    }\r\n";
+  generated_code += "  };\r\n";
+
+  save_file_if_changed(generated_code, path_join(m_binding_code_path, "SkUEMarshal.generated.hpp"));
+  }
+
+//=======================================================================================
+// Filters
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::can_export_class(const Class & class_info) const
+  {
+  return does_class_have_static_class(class_info) // Don't export classes that don't export DLL symbols
+    && !m_exported_class_names.count(class_info.m_name) // Don't export classes that have already been exported
+    && std::find(m_skip_classes.begin(), m_skip_classes.end(), class_info.m_name) == m_skip_classes.end(); // Don't export classes that set to skip in config file
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::can_export_method(const Class & class_info, const Function & function) const
+  {
+  // If this function is inherited, do nothing as SkookumScript will inherit it for us
+  if (function.m_owner_class_name != class_info.m_name)
+    return false;
+
+  // We don't support delegates and non-public functions
+  if (function.has_any_function_flags(FUNC_Delegate))
+    {
+    return false;
+    }
+
+  // Latent functions would be coroutines, which are an option
+  if (is_latent_function(function))
+    {
+    return false;
+    }
+
+  // Reject if any of the parameter types is unsupported yet
+  for (auto & param : function.m_params)
+    {
+    if (param.m_array_dim > 1 ||
+      param.is_a("DelegateProperty") ||
+      param.is_a("MulticastDelegateProperty") ||
+      param.is_a("WeakObjectProperty") ||
+      param.is_a("InterfaceProperty"))
+      {
+      return false;
+      }
+
+    if (!is_property_type_supported(param))
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::can_export_property(const Class & class_info, const Property & property) const
+  {
+  // If this property is inherited, do nothing as SkookumScript will inherit it for us
+  if (property.m_owner_class_name != class_info.m_name)
+    return false;
+
+  // Check if property type is supported
+  return is_property_type_supported(property);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::is_latent_function(const Function & function)
+  {
+  return function.m_meta_data.has("Latent") && get_latent_info_param(function) != nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+const Property * SkOfflineGenerator::get_latent_info_param(const Function & function)
+  {
+  const std::string & latent_info_param_name = function.m_meta_data.get("LatentInfo");
+  if (!latent_info_param_name.empty())
+    {
+    for (auto & param : function.m_params)
+      {
+      if (equals_ignore_case(param.m_name, latent_info_param_name))
+        {
+        return &param;
+        }
+      }
+    }
+
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::does_class_have_static_class(const Class & class_info)
+  {
+  return class_info.has_any_class_flags(CLASS_RequiredAPI | CLASS_MinimalAPI);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::is_property_type_supported(const Property & property) const
+  {
+  // Arrays are supported if their elements are
+  if (property.m_inner_p && !is_property_type_supported(*property.m_inner_p))
+    {
+    return false;
+    }
+
+  if (property.is_a("LazyObjectProperty")
+    || property.is_a("AssetObjectProperty")
+    || property.is_a("AssetClassProperty")
+    || property.is_a("WeakObjectProperty"))
+    {
+    return false;
+    }
+
+  return (get_skookum_property_type(property) != SkTypeID_None);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::is_property_read_in_place(const Property & property) const
+  {
+  // Worth it for anything bigger than a scalar - booleans can't be referenced anyway as they might be bitfields
+  switch (get_skookum_property_type(property))
+    {
+    case SkTypeID_Vector2:
+    case SkTypeID_Vector3:
+    case SkTypeID_Vector4:
+    case SkTypeID_Rotation:
+    case SkTypeID_RotationAngles:
+    case SkTypeID_Transform:
+    case SkTypeID_Color:
+    case SkTypeID_UStruct:
+    case SkTypeID_List:            return true;
+    default:                       return false;
+    }
+  }
+
+//=======================================================================================
+// Names and types
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+bool SkOfflineGenerator::is_reserved_keyword(const std::string & name)
+  {
+  for (auto keyword_p : ms_reserved_keywords)
+    {
+    if (name == keyword_p) return true;
+    }
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::skookify_class_name(const std::string & name)
+  {
+  if (name == "Object") return "Entity";
+  if (name == "Class")  return "EntityClass";
+  if (name == "Enum")   return "Enum2"; // HACK
+
+  return name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::skookify_var_name(const std::string & name, bool * is_boolean_p)
+  {
+  if (name.empty()) return name;
+
+  // Change title case to lower case with underscores
+  std::string skookum_name;
+  skookum_name.reserve(name.length() + 16);
+  bool is_boolean = name[0] == 'b' && name.length() > 1 && std::isupper((unsigned char)name[1]);
+  bool was_upper = true;
+  bool was_underscore = true;
+  for (size_t i = size_t(is_boolean); i < name.length(); ++i)
+    {
+    unsigned char c = (unsigned char)name[i];
+    bool is_upper = std::isupper(c) != 0 || std::isdigit(c) != 0;
+    if (is_upper && !was_upper && !was_underscore)
+      {
+      skookum_name += '_';
+      }
+    skookum_name += char(std::tolower(c));
+    was_upper = is_upper;
+    was_underscore = (c == '_');
+    }
+
+  // Check for reserved keywords and append underscore if found
+  if (is_reserved_keyword(skookum_name))
+    {
+    skookum_name += '_';
+    }
+
+  if (is_boolean_p) *is_boolean_p = is_boolean;
+  return skookum_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::skookify_method_name(const std::string & name, const Property * return_property_p)
+  {
+  const bool returns_boolean = return_property_p && return_property_p->is_a("BoolProperty");
+
+  bool is_boolean = false;
+  std::string method_name = skookify_var_name(name, &is_boolean);
+
+  // Remove K2 (Kismet 2) prefix if present
+  if (starts_with(method_name, "k2_"))
+    {
+    method_name.erase(0, 3);
+    }
+
+  // If name starts with "get_", remove it
+  if (starts_with(method_name, "get_"))
+    {
+    method_name.erase(0, 4);
+    // Append question mark
+    is_boolean = true;
+    }
+  // If name starts with "set_", remove it and append "_set" instead
+  else if (starts_with(method_name, "set_"))
+    {
+    method_name.erase(0, 4);
+    method_name += "_set";
+    }
+
+  // If name starts with "is_", "has_" or "can_" also append question mark
+  if (starts_with(method_name, "is_") || starts_with(method_name, "has_") || starts_with(method_name, "can_"))
+    {
+    is_boolean = true;
+    }
+
+  // Append question mark if determined to be boolean
+  if (is_boolean && returns_boolean)
+    {
+    method_name += "?";
+    }
+
+  return method_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_skookum_class_name(const Class & class_info)
+  {
+  return skookify_class_name(class_info.m_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_skookum_class_path(const Class & class_info)
+  {
+  // Remember class name
+  std::string class_name = skookify_class_name(class_info.m_name);
+
+  // All super classes are also considered used
+  std::vector<std::string> super_class_stack(class_info.m_super_class_names.begin(), class_info.m_super_class_names.end());
+  m_used_class_names.insert(super_class_stack.begin(), super_class_stack.end());
+
+  // Build path
+  int32_t max_super_class_nesting = std::max(m_scripts_path_depth - 1, 0);
+  std::string class_path = path_join(m_scripts_path, "Object");
+  for (int32_t i = 0; i < max_super_class_nesting && !super_class_stack.empty(); ++i)
+    {
+    class_path = path_join(class_path, skookify_class_name(super_class_stack.back()));
+    super_class_stack.pop_back();
+    }
+  if (!super_class_stack.empty())
+    {
+    class_name = skookify_class_name(super_class_stack[0]) + "." + class_name;
+    }
+  return path_join(class_path, class_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_skookum_method_path(const Class & class_info, const std::string & script_function_name, bool is_static)
+  {
+  return path_join(get_skookum_class_path(class_info), replace_all(script_function_name, "?", "-Q") + (is_static ? "()C.sk" : "().sk"));
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkOfflineGenerator::eSkTypeID SkOfflineGenerator::get_skookum_property_type(const Property & property) const
+  {
+  // Check for simple types first
+  if (property.is_a("IntProperty"))         return SkTypeID_Integer;
+  if (property.is_a("FloatProperty"))       return SkTypeID_Real;
+  if (property.is_a("StrProperty"))         return SkTypeID_String;
+  if (property.is_a("NameProperty"))        return SkTypeID_Name;
+  if (property.is_a("BoolProperty"))        return SkTypeID_Boolean;
+
+  // Any known struct?
+  if (property.is_a("StructProperty"))
+    {
+    const std::string & struct_name = property.m_type_object_name;
+
+    if (struct_name == "Vector2D")     return SkTypeID_Vector2;
+    if (struct_name == "Vector")       return SkTypeID_Vector3;
+    if (struct_name == "Vector4")      return SkTypeID_Vector4;
+    if (struct_name == "Quat")         return SkTypeID_Rotation;
+    if (struct_name == "Rotator")      return SkTypeID_RotationAngles;
+    if (struct_name == "Transform")    return SkTypeID_Transform;
+    if (struct_name == "Color")        return SkTypeID_Color;
+    if (struct_name == "LinearColor")  return SkTypeID_Color;
+
+    // Other structs only get value type classes with GenerateStructBindings, which load_settings() rejects
+    }
+
+  if (property.is_a("ClassProperty"))       return SkTypeID_UClass;
+  if (property.is_object_property_base())   return SkTypeID_UObject;
+
+  // Arrays of any known type except arrays
+  if (property.is_a("ArrayProperty") && property.m_inner_p)
+    {
+    eSkTypeID inner_type_id = get_skookum_property_type(*property.m_inner_p);
+    if (inner_type_id != SkTypeID_None && inner_type_id != SkTypeID_List) return SkTypeID_List;
+    }
+
+  // Didn't find a known type
+  return SkTypeID_None;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_skookum_property_type_name(const Property & property)
+  {
+  eSkTypeID type_id = get_skookum_property_type(property);
+  if (type_id == SkTypeID_UObject)
+    {
+    m_used_class_names.insert(property.m_type_object_name);
+    return skookify_class_name(property.m_type_object_name);
+    }
+  if (type_id == SkTypeID_List)
+    {
+    return "List{" + get_skookum_property_type_name(*property.m_inner_p) + "}";
+    }
+
+  return ms_sk_type_id_names[type_id];
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_skookum_binding_class_name(const Property & property)
+  {
+  eSkTypeID type_id = get_skookum_property_type(property);
+  if (type_id == SkTypeID_UObject)
+    {
+    return "SkUE" + get_skookum_property_type_name(property);
+    }
+  if (type_id == SkTypeID_List)
+    {
+    return format("SkUEList<%s, %s>", get_skookum_binding_class_name(*property.m_inner_p).c_str(), get_cpp_array_element_type_name(property).c_str());
+    }
+
+  return ms_sk_type_id_binding_class_names[type_id];
+  }
+
+//---------------------------------------------------------------------------------------
+
+uint32_t SkOfflineGenerator::get_skookum_string_crc(const std::string & string)
+  {
+  // Names are UTF-8 already, just like the plugin converts them before hashing
+  return mem_crc32(string.data(), string.length());
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_cpp_class_name(const Class & class_info)
+  {
+  return class_info.m_prefix_cpp + class_info.m_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkOfflineGenerator::get_cpp_array_element_type_name(const Property & array_property)
+  {
+  // The snapshot records arrays as TArray<element type> with the element type the plugin would use - a TSubclassOf<>
+  // element keeps its own type there while the inner property itself is recorded as UClass *
+  const std::string & array_type_name = array_property.m_cpp_type_name;
+  if (starts_with(array_type_name, "TArray<") && array_type_name.back() == '>')
+    {
+    return array_type_name.substr(7, array_type_name.length() - 8);
+    }
+  return array_property.m_inner_p->m_cpp_type_name;
+  }
+
+//=======================================================================================
+// Files
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::save_file_if_changed(const std::string & text, const std::string & file_path)
+  {
+  // Leave unchanged files alone so the compiler and IDE only pick up what actually changed
+  const std::string file_key = normalize_path(file_path);
+  const uint32_t crc = mem_crc32(text.data(), text.length());
+  std::error_code error;
+
+  // Written or verified by an earlier generate() call and untouched since - no need to read it back
+  auto state_it = m_output_file_states.find(file_key);
+  if (state_it != m_output_file_states.end() && state_it->second.m_crc == crc && state_it->second.m_size == text.length())
+    {
+    const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(file_path, error);
+    if (!error && write_time == state_it->second.m_write_time && std::filesystem::file_size(file_path, error) == text.length() && !error)
+      {
+      return;
+      }
+    }
+
+  if (std::filesystem::file_size(file_path, error) == text.length() && !error)
+    {
+    std::string old_text;
+    if (load_text_file(file_path, &old_text) && old_text == text)
+      {
+      record_output_file_state(file_key, crc, text.length());
+      return;
+      }
+    }
+
+  std::filesystem::create_directories(std::filesystem::path(file_path).parent_path(), error);
+  std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+  file.write(text.data(), text.length());
+  file.close();
+  if (!file)
+    {
+    m_output_file_states.erase(file_key);
+    throw std::runtime_error("Could not save file: " + file_path);
+    }
+  record_output_file_state(file_key, crc, text.length());
+  ++m_written_file_count;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::record_output_file_state(const std::string & file_key, uint32_t crc, uint64_t size)
+  {
+  std::error_code error;
+  const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(file_key, error);
+  if (error)
+    {
+    m_output_file_states.erase(file_key);
+    return;
+    }
+  m_output_file_states[file_key] = { crc, size, write_time };
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::save_script_file(const std::string & text, const std::string & file_path)
+  {
+  m_script_file_paths.insert(normalize_path(file_path));
+  save_file_if_changed(text, file_path);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::delete_stale_script_files()
+  {
+  namespace fs = std::filesystem;
+
+  const fs::path object_path = path_join(m_scripts_path, "Object");
+  std::error_code error;
+  if (!fs::is_directory(object_path, error))
+    {
+    return;
+    }
+
+  std::vector<fs::path> directory_paths;
+  std::vector<fs::path> stale_file_paths;
+  for (fs::recursive_directory_iterator it(object_path, error), end; !error && it != end; it.increment(error))
+    {
+    if (it->is_directory(error))
+      {
+      directory_paths.push_back(it->path());
+      }
+    else if (!m_script_file_paths.count(normalize_path(it->path().string())))
+      {
+      stale_file_paths.push_back(it->path());
+      }
+    }
+  for (auto & file_path : stale_file_paths)
+    {
+    fs::remove(file_path, error);
+    m_output_file_states.erase(normalize_path(file_path.string()));
+    }
+
+  // Folders are classes to SkookumScript, so remove those left empty - innermost first as a non-empty folder won't be deleted
+  std::sort(directory_paths.begin(), directory_paths.end(), [](const fs::path & a, const fs::path & b) { return a.native().length() > b.native().length(); });
+  for (auto & directory_path : directory_paths)
+    {
+    if (fs::is_empty(directory_path, error))
+      {
+      fs::remove(directory_path, error);
+      }
+    }
+  }
+
+//=======================================================================================
+// MethodBinding implementation
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::MethodBinding::make_method(const Function & function)
+  {
+  m_script_name = skookify_method_name(function.m_name, function.get_return_property());
+  m_code_name = replace_all(m_script_name, "?", "_Q");
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::MethodBinding::make_property_getter(const Property & property)
+  {
+  m_script_name = skookify_method_name(property.m_name, &property);
+  m_code_name = replace_all(m_script_name, "?", "_Q");
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkOfflineGenerator::MethodBinding::make_property_setter(const Property & property)
+  {
+  m_script_name = skookify_method_name(property.m_name) + "_set";
+  m_code_name = m_script_name;
+  }
@@ -0,0 +1,161 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Regenerates script and binding files from a reflection snapshot, without UHT
+//=======================================================================================
+
+#pragma once
+
+#include "ReflectionModel.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+//---------------------------------------------------------------------------------------
+// Port of the default code path of FSkookumScriptGenerator working on a SkReflection::Model
+// instead of live UClasses - produces the same files as the UHT plugin with all optional
+// [SkookumScriptGenerator] features switched off, and refuses to run if any is switched on
+class SkOfflineGenerator
+  {
+  public:
+
+    SkOfflineGenerator(const std::string & binding_code_path, const std::string & runtime_plugin_root_path);
+
+    void        load_settings(const std::string & engine_ini_file_path); // Same [SkookumScriptGenerator] section the plugin reads - throws std::runtime_error on options not supported here
+    void        generate(const SkReflection::Model & model); // Generate all files, writing only those whose contents changed - can be called repeatedly, e.g. whenever the snapshot changes
+
+    const std::string & get_scripts_path() const  { return m_scripts_path; }
+    int32_t     get_written_file_count() const    { return m_written_file_count; }
+
+  protected:
+
+    //---------------------------------------------------------------------------------------
+    // Types
+
+    enum eSkTypeID
+      {
+      SkTypeID_None = 0,
+      SkTypeID_Integer,
+      SkTypeID_Real,
+      SkTypeID_Boolean,
+      SkTypeID_String,
+      SkTypeID_Name,
+      SkTypeID_Vector2,
+      SkTypeID_Vector3,
+      SkTypeID_Vector4,
+      SkTypeID_Rotation,
+      SkTypeID_RotationAngles,
+      SkTypeID_Transform,
+      SkTypeID_Color,
+      SkTypeID_UClass,
+      SkTypeID_UObject,
+      SkTypeID_UStruct,
+      SkTypeID_List,
+
+      SkTypeID__Count
+      };
+
+    // Contents of an output file as last written or verified by this generator
+    struct OutputFileState
+      {
+      uint32_t m_crc;
+      uint64_t m_size;
+      std::filesystem::file_time_type m_write_time; // To notice the file having been changed by someone else since
+      };
+
+    // To keep track of bindings generated for a particular class
+    struct MethodBinding
+      {
+      void make_method(const SkReflection::Function & function); // create names for a method
+      void make_property_getter(const SkReflection::Property & property);
+      void make_property_setter(const SkReflection::Property & property);
+
+      bool operator == (const MethodBinding & other) const { return m_script_name == other.m_script_name; }
+
+      std::string m_script_name;
+      std::string m_code_name;
+      };
+
+    //---------------------------------------------------------------------------------------
+    // Data
+
+    static const char * const ms_sk_type_id_names[SkTypeID__Count]; // Names belonging to the ids above
+    static const char * const ms_sk_type_id_binding_class_names[SkTypeID__Count]; // C++ binding classes belonging to the ids above - used as SkMarshal<> template argument
+    static const char * const ms_reserved_keywords[]; // = Forbidden variable names
+
+    std::string           m_binding_code_path; // Output folder for generated binding code files
+    std::string           m_scripts_path; // Output folder for generated script files
+    int32_t               m_scripts_path_depth; // Amount of super classes until we start flattening the script file hierarchy, 1 = everything is right under 'Object'
+    std::string           m_runtime_plugin_root_path; // Root of the runtime plugin we're generating the code for - used as base path for include files
+    std::vector<std::string> m_skip_classes; // All classes set to skip in the ini file
+
+    const SkReflection::Model * m_model_p; // Model of the current generate() call
+    std::vector<std::string> m_all_header_file_names; // Keep track of all headers generated
+    std::vector<std::string> m_all_binding_file_names; // Keep track of all binding files generated
+    std::vector<const SkReflection::Class *> m_exported_classes; // Whenever a class gets exported, it gets added to this list
+    std::unordered_set<std::string> m_exported_class_names; // Names of m_exported_classes
+    std::vector<const SkReflection::Class *> m_extra_classes; // Classes rejected to export at first, but possibly exported later if ever used
+    std::unordered_set<std::string> m_used_class_names; // All classes used as types (by parameters, properties etc.)
+    std::unordered_set<std::string> m_script_file_paths; // All script files generated in this run - any other file in the scripts folder is stale
+    int32_t               m_written_file_count; // Files actually written in this run
+    std::unordered_map<std::string, OutputFileState> m_output_file_states; // Normalized path -> state, kept across generate() calls so unchanged outputs need not be read back
+
+    //---------------------------------------------------------------------------------------
+    // Methods
+
+    void        generate_class(const SkReflection::Class & class_info); // Generate script and binding files for a class and its methods and properties
+    void        generate_class_script_files(const SkReflection::Class & class_info);
+    void        generate_class_header_file(const SkReflection::Class & class_info);
+    void        generate_class_binding_file(const SkReflection::Class & class_info);
+
+    std::string generate_method(const std::string & class_name_cpp, const SkReflection::Class & class_info, const SkReflection::Function & function, const MethodBinding & binding);
+    void        generate_method_script_file(const SkReflection::Class & class_info, const SkReflection::Function & function, const std::string & script_function_name);
+    std::string generate_method_binding_code(const std::string & class_name_cpp, const SkReflection::Class & class_info, const SkReflection::Function & function, const MethodBinding & binding);
+
+    std::string generate_property_getter(const std::string & class_name_cpp, const SkReflection::Class & class_info, const SkReflection::Property & property, const MethodBinding & binding);
+    std::string generate_property_setter(const std::string & class_name_cpp, const SkReflection::Class & class_info, const SkReflection::Property & property, const MethodBinding & binding);
+
+    std::string generate_method_binding_declaration(const std::string & function_name, bool is_static);
+    std::string generate_this_pointer_initialization(const std::string & class_name_cpp, const SkReflection::Class & class_info, bool is_static);
+    std::string generate_this_pointer_assert(const std::string & message);
+    std::string generate_property_lookup(const SkReflection::Class & class_info, const SkReflection::Property & property);
+    std::string generate_method_parameter_expression(const SkReflection::Property & param, int32_t param_index);
+    std::string generate_property_default_ctor_argument(const SkReflection::Property & param);
+    std::string generate_return_value_passing(const SkReflection::Property * return_value_p, const std::string & return_value_name);
+
+    void        generate_master_binding_file();
+    void        generate_marshal_traits_file();
+
+    bool        can_export_class(const SkReflection::Class & class_info) const;
+    bool        can_export_method(const SkReflection::Class & class_info, const SkReflection::Function & function) const;
+    bool        can_export_property(const SkReflection::Class & class_info, const SkReflection::Property & property) const;
+    static bool is_latent_function(const SkReflection::Function & function);
+    static const SkReflection::Property * get_latent_info_param(const SkReflection::Function & function);
+    static bool does_class_have_static_class(const SkReflection::Class & class_info);
+    bool        is_property_type_supported(const SkReflection::Property & property) const;
+    bool        is_property_read_in_place(const SkReflection::Property & property) const;
+
+    static bool        is_reserved_keyword(const std::string & name);
+    static std::string skookify_class_name(const std::string & name);
+    static std::string skookify_var_name(const std::string & name, bool * is_boolean_p = nullptr);
+    static std::string skookify_method_name(const std::string & name, const SkReflection::Property * return_property_p = nullptr);
+    static std::string get_skookum_class_name(const SkReflection::Class & class_info);
+    std::string get_skookum_class_path(const SkReflection::Class & class_info);
+    std::string get_skookum_method_path(const SkReflection::Class & class_info, const std::string & script_function_name, bool is_static);
+    eSkTypeID   get_skookum_property_type(const SkReflection::Property & property) const;
+    std::string get_skookum_property_type_name(const SkReflection::Property & property);
+    std::string get_skookum_binding_class_name(const SkReflection::Property & property);
+    static uint32_t    get_skookum_string_crc(const std::string & string);
+    static std::string get_cpp_class_name(const SkReflection::Class & class_info);
+    static std::string get_cpp_array_element_type_name(const SkReflection::Property & array_property); // Exact element type of a TArray as recorded in its C++ type, keeping TSubclassOf<>
+
+    void        save_file_if_changed(const std::string & text, const std::string & file_path); // Write a file unless it already has this content - throws on failure
+    void        record_output_file_state(const std::string & file_key, uint32_t crc, uint64_t size);
+    void        save_script_file(const std::string & text, const std::string & file_path); // Same, remembering the file as generated in this run
+    void        delete_stale_script_files(); // Remove script files and folders not generated in this run
+  };
@@ -0,0 +1,183 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Reflection data the generator consumes, as recorded in a reflection snapshot
+// (SkUEReflection.snapshot) by the UHT plugin - lets bindings be regenerated without UHT
+//=======================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SkReflection
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Flag values as defined by the engine (ObjectBase.h, Class.h) - only those the generator looks at
+
+  enum : uint32_t
+    {
+    CLASS_MinimalAPI  = 0x00080000u,
+    CLASS_RequiredAPI = 0x00100000u,
+    };
+
+  enum : uint32_t
+    {
+    FUNC_Static        = 0x00002000u,
+    FUNC_Delegate      = 0x00100000u,
+    FUNC_BlueprintPure = 0x10000000u,
+    };
+
+  enum : uint64_t
+    {
+    CPF_Edit          = 0x0000000000000001ull,
+    CPF_ConstParm     = 0x0000000000000002ull,
+    CPF_OutParm       = 0x0000000000000100ull,
+    CPF_ReturnParm    = 0x0000000000000400ull,
+    CPF_ReferenceParm = 0x0000000008000000ull,
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Meta data entries recorded for a field - only the keys the generator consults
+
+  struct MetaData
+    {
+    bool                has(const std::string & key) const { return find(key) != nullptr; }
+    const std::string & get(const std::string & key) const { static const std::string empty; const std::string * value_p = find(key); return value_p ? *value_p : empty; }
+
+    const std::string * find(const std::string & key) const
+      {
+      for (auto & entry : m_entries)
+        {
+        if (entry.first == key) return &entry.second;
+        }
+      return nullptr;
+      }
+
+    std::vector<std::pair<std::string, std::string>> m_entries; // Key -> value, in recording order
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A UProperty - class property, function parameter, struct field or array element
+
+  struct Property
+    {
+    // Same as UObject::IsA() on the property class, for the property classes the generator distinguishes
+    bool is_a(const char * property_class_name_p) const { return m_property_class_name == property_class_name_p; }
+    bool is_object_property_base() const
+      {
+      return is_a("ObjectProperty") || is_a("ClassProperty") || is_a("WeakObjectProperty")
+        || is_a("LazyObjectProperty") || is_a("AssetObjectProperty") || is_a("AssetClassProperty");
+      }
+    bool has_any_property_flags(uint64_t flags) const { return (m_property_flags & flags) != 0; }
+
+    std::string         m_name;
+    std::string         m_property_class_name; // E.g. FloatProperty
+    std::string         m_cpp_type_name; // As passed to or returned from a function, forward declaration keywords stripped
+    uint64_t            m_property_flags = 0;
+    int32_t             m_array_dim = 1;
+    MetaData            m_meta_data;
+    std::string         m_type_object_name; // Struct of a StructProperty, enum of a ByteProperty, meta class of a ClassProperty, property class of other object properties
+    std::string         m_owner_class_name; // Class declaring it - class properties only
+    std::unique_ptr<Property> m_inner_p; // Element type of an ArrayProperty
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A UFunction with its parameters, return value last if any
+
+  struct Function
+    {
+    bool            has_any_function_flags(uint32_t flags) const { return (m_function_flags & flags) != 0; }
+    bool            has_params_or_return_value() const { return !m_params.empty(); }
+    const Property * get_return_property() const
+      {
+      for (auto & param : m_params)
+        {
+        if (param.has_any_property_flags(CPF_ReturnParm)) return &param;
+        }
+      return nullptr;
+      }
+
+    std::string           m_name;
+    std::string           m_owner_class_name;
+    uint32_t              m_function_flags = 0;
+    MetaData              m_meta_data;
+    std::vector<Property> m_params;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A UClass as handed to the generator by UHT, with all functions and properties including inherited ones
+
+  struct Class
+    {
+    bool has_any_class_flags(uint32_t flags) const { return (m_class_flags & flags) != 0; }
+    bool is_child_of(const std::string & class_name) const
+      {
+      if (m_name == class_name) return true;
+      for (auto & super_class_name : m_super_class_names)
+        {
+        if (super_class_name == class_name) return true;
+        }
+      return false;
+      }
+
+    std::string              m_name;
+    std::string              m_prefix_cpp; // E.g. U or A
+    std::string              m_source_header_file_name; // Empty if unknown
+    uint32_t                 m_class_flags = 0;
+    uint64_t                 m_cast_flags = 0;
+    MetaData                 m_meta_data;
+    std::vector<std::string> m_super_class_names; // Nearest first
+    std::vector<Function>    m_functions;
+    std::vector<Property>    m_properties;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A UScriptStruct referenced by a recorded property
+
+  struct Struct
+    {
+    std::string           m_name;
+    std::string           m_prefix_cpp;
+    std::string           m_path_name;
+    uint32_t              m_struct_flags = 0;
+    MetaData              m_meta_data;
+    std::vector<Property> m_fields;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A UEnum referenced by a recorded property - values are implied by their position
+
+  struct Enum
+    {
+    std::string              m_name;
+    std::string              m_cpp_type;
+    MetaData                 m_meta_data;
+    std::vector<std::string> m_value_names;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Everything recorded in one snapshot
+
+  struct Model
+    {
+    const Class * find_class(const std::string & name) const
+      {
+      for (auto & class_info : m_classes)
+        {
+        if (class_info.m_name == name) return &class_info;
+        }
+      return nullptr;
+      }
+
+    std::vector<Class>  m_classes; // In the order UHT handed them to the generator
+    std::vector<Struct> m_structs;
+    std::vector<Enum>   m_enums;
+    };
+
+  } // SkReflection
@@ -0,0 +1,214 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Reads a reflection snapshot written by the UHT plugin into a SkReflection::Model
+//=======================================================================================
+
+#include "SnapshotReader.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::load(const std::string & file_path, SkReflection::Model * model_p)
+  {
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file)
+    {
+    throw std::runtime_error("Could not load reflection snapshot: " + file_path);
+    }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  SkSnapshotReader reader(file_path, data);
+  reader.read_model(model_p);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::read_model(SkReflection::Model * model_p)
+  {
+  // Layout as written by FSkookumScriptGenerator::save_reflection_snapshot()
+  uint32_t magic = read<uint32_t>();
+  uint32_t version = read<uint32_t>();
+  if (magic != 0x53524b53u || version != 2u) // 'SKRS'
+    {
+    fail("Unknown reflection snapshot format");
+    }
+
+  int32_t name_count = read_count();
+  m_names.clear();
+  m_names.reserve(name_count);
+  for (int32_t i = 0; i < name_count; ++i)
+    {
+    int32_t length = read_count();
+    std::string name(length, '\0');
+    read_bytes(&name[0], length);
+    m_names.push_back(std::move(name));
+    }
+
+  // Classes
+  *model_p = SkReflection::Model();
+  model_p->m_classes.resize(read_count());
+  for (auto & class_info : model_p->m_classes)
+    {
+    read_class(&class_info);
+    }
+
+  // Structs
+  model_p->m_structs.resize(read_count());
+  for (auto & struct_info : model_p->m_structs)
+    {
+    struct_info.m_name = read_name();
+    struct_info.m_prefix_cpp = read_name();
+    struct_info.m_path_name = read_name();
+    struct_info.m_struct_flags = read<uint32_t>();
+    read_meta_data(&struct_info.m_meta_data);
+    struct_info.m_fields.resize(read_count());
+    for (auto & field : struct_info.m_fields)
+      {
+      read_property(&field);
+      }
+    }
+
+  // Enums
+  model_p->m_enums.resize(read_count());
+  for (auto & enum_info : model_p->m_enums)
+    {
+    enum_info.m_name = read_name();
+    enum_info.m_cpp_type = read_name();
+    read_meta_data(&enum_info.m_meta_data);
+    enum_info.m_value_names.resize(read_count());
+    for (auto & value_name : enum_info.m_value_names)
+      {
+      value_name = read_name();
+      }
+    }
+
+  if (m_pos != m_data.size())
+    {
+    fail("Trailing data in reflection snapshot");
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::read_class(SkReflection::Class * class_p)
+  {
+  class_p->m_name = read_name();
+  class_p->m_prefix_cpp = read_name();
+  class_p->m_source_header_file_name = read_name();
+  class_p->m_class_flags = read<uint32_t>();
+  class_p->m_cast_flags = read<uint64_t>();
+  read_meta_data(&class_p->m_meta_data);
+
+  class_p->m_super_class_names.resize(read_count());
+  for (auto & super_class_name : class_p->m_super_class_names)
+    {
+    super_class_name = read_name();
+    }
+
+  class_p->m_functions.resize(read_count());
+  for (auto & function : class_p->m_functions)
+    {
+    function.m_name = read_name();
+    function.m_owner_class_name = read_name();
+    function.m_function_flags = read<uint32_t>();
+    read_meta_data(&function.m_meta_data);
+    function.m_params.resize(read_count());
+    for (auto & param : function.m_params)
+      {
+      read_property(&param);
+      }
+    }
+
+  class_p->m_properties.resize(read_count());
+  for (auto & property : class_p->m_properties)
+    {
+    property.m_owner_class_name = read_name();
+    read_property(&property);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::read_property(SkReflection::Property * property_p)
+  {
+  property_p->m_name = read_name();
+  property_p->m_property_class_name = read_name();
+  property_p->m_cpp_type_name = read_name();
+  property_p->m_property_flags = read<uint64_t>();
+  property_p->m_array_dim = read<int32_t>();
+  read_meta_data(&property_p->m_meta_data);
+  property_p->m_type_object_name = read_name();
+
+  // Array element type follows its array
+  uint8_t has_inner = read<uint8_t>();
+  if (has_inner)
+    {
+    property_p->m_inner_p.reset(new SkReflection::Property);
+    read_property(property_p->m_inner_p.get());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::read_meta_data(SkReflection::MetaData * meta_data_p)
+  {
+  meta_data_p->m_entries.resize(read_count());
+  for (auto & entry : meta_data_p->m_entries)
+    {
+    entry.first = read_name();
+    entry.second = read_name();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+std::string SkSnapshotReader::read_name()
+  {
+  int32_t index = read<int32_t>();
+  if (index < 0 || size_t(index) >= m_names.size())
+    {
+    fail("Name index out of range in reflection snapshot");
+    }
+  return m_names[index];
+  }
+
+//---------------------------------------------------------------------------------------
+
+int32_t SkSnapshotReader::read_count()
+  {
+  // Every element takes at least a byte, so a count beyond what's left means a corrupt file rather than a huge allocation
+  int32_t count = read<int32_t>();
+  if (count < 0 || size_t(count) > m_data.size() - m_pos)
+    {
+    fail("Corrupt count in reflection snapshot");
+    }
+  return count;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::read_bytes(void * dest_p, size_t length)
+  {
+  if (length > m_data.size() - m_pos)
+    {
+    fail("Unexpected end of reflection snapshot");
+    }
+  if (length)
+    {
+    std::memcpy(dest_p, m_data.data() + m_pos, length);
+    }
+  m_pos += length;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkSnapshotReader::fail(const char * what_p) const
+  {
+  throw std::runtime_error(std::string(what_p) + ": " + m_file_path);
+  }
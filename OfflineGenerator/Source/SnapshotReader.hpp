@@ -0,0 +1,42 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Reads a reflection snapshot written by the UHT plugin into a SkReflection::Model
+//=======================================================================================
+
+#pragma once
+
+#include "ReflectionModel.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class SkSnapshotReader
+  {
+  public:
+
+    // Throws std::runtime_error if the file can't be read or isn't a valid snapshot
+    static void load(const std::string & file_path, SkReflection::Model * model_p);
+
+  protected:
+
+    SkSnapshotReader(const std::string & file_path, const std::vector<uint8_t> & data) : m_file_path(file_path), m_data(data), m_pos(0) {}
+
+    void        read_model(SkReflection::Model * model_p);
+    void        read_class(SkReflection::Class * class_p);
+    void        read_property(SkReflection::Property * property_p);
+    void        read_meta_data(SkReflection::MetaData * meta_data_p);
+    std::string read_name();
+    int32_t     read_count();
+    void        read_bytes(void * dest_p, size_t length);
+    template<typename _Type> _Type read() { _Type value; read_bytes(&value, sizeof(value)); return value; } // Snapshots are little endian like all platforms UHT runs on
+
+    [[noreturn]] void fail(const char * what_p) const;
+
+    const std::string &       m_file_path;
+    const std::vector<uint8_t> & m_data;
+    size_t                    m_pos; // Read position in m_data
+    std::vector<std::string>  m_names; // String table
+  };
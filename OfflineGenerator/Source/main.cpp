@@ -0,0 +1,166 @@
+//=======================================================================================
+// SkookumScript Unreal Engine Binding Generator
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Command line driver regenerating bindings from a reflection snapshot
+//=======================================================================================
+
+#include "OfflineGenerator.hpp"
+#include "SnapshotReader.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+//---------------------------------------------------------------------------------------
+
+static int print_usage()
+  {
+  std::cerr <<
+    "Usage: SkookumScriptOfflineGenerator <snapshot> <binding code folder> <include base> [-ini <engine ini>] [-watch [<poll ms>]]\n"
+    "  <snapshot>             SkUEReflection.snapshot written by the UHT plugin\n"
+    "  <binding code folder>  Where UHT puts the generated binding code (its output directory)\n"
+    "  <include base>         Root of the runtime plugin - scripts go to <include base>/../../Scripts/Engine-Generated\n"
+    "  -ini <engine ini>      Ini file with the [SkookumScriptGenerator] section, for SkipClasses\n"
+    "  -watch [<poll ms>]     Keep running and regenerate whenever the snapshot or the ini file changes (default poll 100 ms)\n";
+  return 2;
+  }
+
+//---------------------------------------------------------------------------------------
+// Keeps the model and the generator (with its output file states) alive between changes,
+// reloading only what changed - a save followed by a UHT run updates the outputs in
+// roughly the time it takes to write the files that actually differ
+
+[[noreturn]] static void watch(SkOfflineGenerator * generator_p, const std::string & snapshot_file_path, const std::string & engine_ini_file_path, const std::string & binding_code_path, int32_t poll_ms)
+  {
+  namespace fs = std::filesystem;
+
+  // Write time of a file, min() if it is missing - so a missing file gets reported once rather than on every poll
+  auto get_write_time = [](const std::string & file_path)
+    {
+    std::error_code error;
+    const fs::file_time_type write_time = fs::last_write_time(file_path, error);
+    return error ? fs::file_time_type::min() : write_time;
+    };
+
+  SkReflection::Model model;
+  bool is_model_valid = false;
+  bool are_settings_valid = engine_ini_file_path.empty();
+  fs::file_time_type snapshot_write_time = fs::file_time_type::max(); // = Not looked at yet
+  fs::file_time_type ini_write_time = fs::file_time_type::max();
+
+  std::cout << "Watching " << snapshot_file_path << (engine_ini_file_path.empty() ? "" : " and " + engine_ini_file_path) << " - press Ctrl+C to stop.\n" << std::flush;
+  for (;; std::this_thread::sleep_for(std::chrono::milliseconds(poll_ms)))
+    {
+    // Times are taken before reading, so a write still in progress shows up as another change
+    const fs::file_time_type new_snapshot_write_time = get_write_time(snapshot_file_path);
+    const fs::file_time_type new_ini_write_time = engine_ini_file_path.empty() ? ini_write_time : get_write_time(engine_ini_file_path);
+    const bool has_snapshot_changed = (new_snapshot_write_time != snapshot_write_time);
+    const bool has_ini_changed = (new_ini_write_time != ini_write_time);
+    if (!has_snapshot_changed && !has_ini_changed)
+      {
+      continue;
+      }
+    snapshot_write_time = new_snapshot_write_time;
+    ini_write_time = new_ini_write_time;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    try
+      {
+      if (has_ini_changed)
+        {
+        are_settings_valid = false;
+        generator_p->load_settings(engine_ini_file_path);
+        are_settings_valid = true;
+        }
+      if (has_snapshot_changed)
+        {
+        SkReflection::Model new_model;
+        SkSnapshotReader::load(snapshot_file_path, &new_model);
+        model = std::move(new_model);
+        is_model_valid = true;
+        }
+      if (is_model_valid && are_settings_valid)
+        {
+        generator_p->generate(model);
+        const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+        std::cout << "Regenerated bindings for " << model.m_classes.size() << " recorded classes into " << binding_code_path << " and " << generator_p->get_scripts_path()
+          << " in " << elapsed_ms << " ms, " << generator_p->get_written_file_count() << " files changed.\n" << std::flush;
+        }
+      }
+    catch (const std::exception & exception)
+      {
+      // Keep watching - the next save will likely fix it
+      std::cerr << "Error: " << exception.what() << "\n" << std::flush;
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+  {
+  if (argc < 4)
+    {
+    return print_usage();
+    }
+
+  std::string engine_ini_file_path;
+  bool is_watching = false;
+  int32_t poll_ms = 100;
+  for (int arg_index = 4; arg_index < argc; ++arg_index)
+    {
+    if (std::strcmp(argv[arg_index], "-ini") == 0 && arg_index + 1 < argc)
+      {
+      engine_ini_file_path = argv[++arg_index];
+      }
+    else if (std::strcmp(argv[arg_index], "-watch") == 0)
+      {
+      is_watching = true;
+      if (arg_index + 1 < argc && argv[arg_index + 1][0] != '-')
+        {
+        poll_ms = std::atoi(argv[++arg_index]);
+        if (poll_ms <= 0)
+          {
+          return print_usage();
+          }
+        }
+      }
+    else
+      {
+      return print_usage();
+      }
+    }
+
+  try
+    {
+    SkOfflineGenerator generator(argv[2], argv[3]);
+    if (is_watching)
+      {
+      watch(&generator, argv[1], engine_ini_file_path, argv[2], poll_ms); // Does not return
+      }
+
+    SkReflection::Model model;
+    SkSnapshotReader::load(argv[1], &model);
+
+    if (!engine_ini_file_path.empty())
+      {
+      generator.load_settings(engine_ini_file_path);
+      }
+    generator.generate(model);
+
+    std::cout << "Generated bindings for " << model.m_classes.size() << " recorded classes into " << argv[2] << " and " << generator.get_scripts_path()
+      << ", " << generator.get_written_file_count() << " files changed.\n";
+    }
+  catch (const std::exception & error)
+    {
+    std::cerr << "Error: " << error.what() << "\n";
+    return 1;
+    }
+
+  return 0;
+  }
@@ -53,6 +53,8 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
     SkTypeID_Color,
     SkTypeID_UClass,
     SkTypeID_UObject,
+    SkTypeID_UStruct,
+    SkTypeID_List,
 
     SkTypeID__Count
     };
@@ -63,11 +65,16 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
     void make_method(UFunction * function_p); // create names for a method
     void make_property_getter(UProperty * property_p);
     void make_property_setter(UProperty * property_p);
+    void make_batch(); // turn names of a scalar binding into names of its batched variant
+    void make_event_method(UProperty * property_p, const TCHAR * suffix_p); // create names for subscribe/unsubscribe methods of a multicast delegate
+    void make_coroutine(UFunction * function_p); // create names for a coroutine wrapping a latent function
+    void make_snapshot(bool is_apply); // create names for the bulk property snapshot/apply methods
 
     bool operator == (const MethodBinding & other) const { return m_script_name == other.m_script_name; }
 
     FString   m_script_name;
     FString   m_code_name;
+    int32     m_descriptor_index; // Row in the class descriptor table if bound via the shared thunk, -1 if bound via unrolled function
     };
 
   // To keep track of classes for later exporting
@@ -81,11 +88,44 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
     FString   m_source_header_file_name;
     };
 
+  // Case sensitive name keys for the name caches - FString comparison is case insensitive by default
+  template<typename _ValueType>
+  struct NameKeyFuncs : TDefaultMapKeyFuncs<FString, _ValueType, false>
+    {
+    static FORCEINLINE bool   Matches(const FString & a, const FString & b) { return a.Equals(b, ESearchCase::CaseSensitive); }
+    static FORCEINLINE uint32 GetKeyHash(const FString & key)               { return FCrc::StrCrc32(*key); }
+    };
+
+  // What a generated file looked like when we last wrote it
+  struct FileHash
+    {
+    uint32    m_crc;
+    int64     m_size;
+    FDateTime m_time_stamp; // Of the file on disk right after writing, to detect edits made since
+    };
+
+  // A header written to a temp file, to be moved into place by rename_temp_files()
+  struct TempHeader
+    {
+    FString   m_file_path; // Final path of the header
+    uint32    m_crc; // Hash of its new contents, recorded once it is in place
+    int64     m_size;
+    };
+
+  // Result of skookify_var_name() as kept in its cache
+  struct VarName
+    {
+    FString m_skookum_name;
+    bool    m_is_boolean;
+    };
+
   //---------------------------------------------------------------------------------------
   // Data
 
   static const FString  ms_sk_type_id_names[SkTypeID__Count]; // Names belonging to the ids above
-  static const FString  ms_reserved_keywords[]; // = Forbidden variable names
+  static const FString  ms_sk_type_id_binding_class_names[SkTypeID__Count]; // C++ binding classes belonging to the ids above - used as SkMarshal<> template argument
+  static const TCHAR * const ms_reserved_keywords[]; // = Forbidden variable names
+  static const TCHAR * const ms_snapshot_meta_data_keys[]; // Meta data the generator consults, recorded for classes, functions, properties, structs and enums
 
   FString               m_binding_code_path; // Output folder for generated binding code files
   FString               m_scripts_path; // Output folder for generated script files
@@ -96,12 +136,57 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
 
   TArray<FString>       m_all_header_file_names; // Keep track of all headers generated
   TArray<FString>       m_all_binding_file_names; // Keep track of all binding files generated
-  TArray<FString>       m_temp_headers; // Keep track of temp headers generated by save_header_if_changed()
+  TArray<TempHeader>    m_temp_headers; // Keep track of temp headers generated by save_header_if_changed()
+  TMap<FString, FileHash> m_file_hashes; // Generated file path -> content hash, persisted across runs so unchanged files need not be read
+  TSet<FString>         m_hashed_file_paths; // Files whose hash got recorded in this run
+  TSet<FString>         m_script_file_paths; // Normalized paths of all script files generated in this run - any other file in the scripts folder is stale
+  bool                  m_update_scripts_in_place; // Keep the scripts folder and only rewrite changed script files instead of wiping it at startup
 
   TSet<UClass *>        m_exported_classes; // Whenever a class gets exported, it gets added to this list
   TArray<ClassRecord>   m_extra_classes; // Classes rejected to export at first, but possibly exported later if ever used
   TArray<UClass *>      m_used_classes; // All classes used as types (by parameters, properties etc.)
+  TArray<UScriptStruct *> m_used_structs; // All structs used as SkTypeID_UStruct types - each gets a value type class generated in FinishExport()
+  TArray<UScriptStruct *> m_exported_structs; // Structs generated so far
+  bool                  m_generate_struct_bindings; // Map USTRUCTs other than the built-in math types to generated value type classes
   TArray<FString>       m_skip_classes; // All classes set to skip in UHT config file (Engine/Programs/UnrealHeaderTool/Config/DefaultEngine.ini)
+  TMap<FString, TArray<FString>> m_property_snapshots; // Class name -> names of the properties its snapshot/apply_snapshot methods transfer in one call
+  TMap<FString, TArray<FString>> m_memoized_functions; // Class name -> names of its pure argument-free functions whose results are cached for the rest of the frame, "*" for all of them
+
+  bool                  m_write_reflection_snapshot; // Record all reflection data the generator consumes into a binary file
+  TArray<uint8>         m_reflection_snapshot_data; // Class records written so far
+  int32                 m_reflection_snapshot_class_count;
+  TArray<UScriptStruct *> m_reflection_snapshot_structs; // Structs referenced by the recorded properties - written after the classes
+  TArray<UEnum *>       m_reflection_snapshot_enums; // Same for enums
+  TArray<FString>       m_reflection_snapshot_names; // String table of the snapshot
+  TMap<FString, int32>  m_reflection_snapshot_name_indices; // Name -> index into m_reflection_snapshot_names
+  bool                  m_write_signature_database; // Also write the signatures of all generated script files as one pre-tokenized binary file
+  TArray<uint8>         m_signature_data; // Signature records written so far
+  int32                 m_signature_count;
+  TArray<FString>       m_signature_names; // String table of the signature database
+  TMap<FString, int32>  m_signature_name_indices; // Name -> index into m_signature_names
+  TSet<FString>         m_signature_file_paths; // Normalized relative paths of the script files recorded so far - each gets one record only
+  bool                  m_use_descriptor_tables; // Bind methods as rows of a constant per-class descriptor table interpreted by a shared thunk instead of unrolled functions
+  bool                  m_generate_batch_bindings; // Also generate class methods operating on a list of receivers for each instance method and property accessor
+  bool                  m_generate_event_bindings; // Generate subscribe/unsubscribe methods for blueprint assignable multicast delegates
+  bool                  m_instrument_bindings; // Wrap binding bodies with call count and cycle counters
+  TArray<FString>       m_binding_stat_names; // Names of the instrumented bindings of the class currently being generated, index = slot in its stats array
+  bool                  m_generate_shipping_profile; // Emit bindings whose null asserts compile out in shipping builds and whose lookups are resolved at registration
+  TArray<FString>       m_function_lookup_names; // UFunctions resolved in register_bindings() of the class currently being generated, index = slot in its function_ptrs array
+  TArray<FString>       m_property_lookup_names; // Same for UProperties and property_ptrs
+  bool                  m_cache_object_wrappers; // Reuse the script instance wrapping a UObject return value instead of allocating a new one per call
+  bool                  m_generate_thread_safe_bindings; // Bind allowlisted static functions without lazy statics or shared state and register them as safe to call off the game thread
+  TMap<FString, TArray<FString>> m_thread_safe_functions; // Class name -> names of its static functions vouched for as thread safe, "*" for all of them
+  TArray<FString>       m_thread_safe_method_names; // Script names of the thread safe methods of the class currently being generated
+
+  int32                 m_shard_count; // Number of generator processes splitting up the classes between them, 0 if not sharded
+  int32                 m_shard_index; // Slice of the classes this process generates, -1 if not sharded or if this is the merge step
+
+  FString               m_entity_coroutine_code; // Binding code of coroutines generated from static latent functions - they are bound to Entity as coroutines need an instance to run on
+  TArray<MethodBinding> m_entity_coroutine_bindings; // Coroutines in m_entity_coroutine_code
+  TArray<int32>         m_entity_coroutine_code_lengths; // Length of the code of each of m_entity_coroutine_bindings, so shards can hand the code over per coroutine
+  bool                  m_generate_coroutines; // Bind latent functions as coroutines that suspend until their latent action completes
+  bool                  m_has_coroutines; // If any latent function got bound as a coroutine
+  bool                  m_return_out_params; // Pass out parameters back to script as return arguments instead of taking them as regular arguments
 
 #ifdef USE_DEBUG_LOG_FILE
   FILE *                m_debug_log_file; // Quick file handle to print debug stuff to, generates log file in output folder
@@ -114,10 +199,12 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
   void                  generate_class_script_files(UClass * class_p); // Generate script files for a class and its methods and properties 
   void                  generate_class_header_file(UClass * class_p, const FString & source_header_file_name); // Generate header file for a class
   void                  generate_class_binding_file(UClass * class_p); // Generate binding code source file for a class
+  void                  generate_struct(UScriptStruct * struct_p); // Generate script and binding files for a value type class wrapping a struct
 
   FString               generate_method(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding); // Generate script file and binding code for a method
   void                  generate_method_script_file(UFunction * function_p, const FString & script_function_name); // Generate script file for a method
   FString               generate_method_binding_code(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding); // Generate binding code for a method
+  void                  generate_method_descriptor(UClass * class_p, UFunction * function_p, const MethodBinding & binding, FString * declarations_p, FString * rows_p); // Generate descriptor table row (and its parameter layout) for a method
 
   FString               generate_property_getter(const FString & class_name_cpp, UClass * class_p, UProperty * property_p, int32 property_index, const MethodBinding & binding); // Generate getter script file and binding code for a property
   FString               generate_property_setter(const FString & class_name_cpp, UClass * class_p, UProperty * property_p, int32 property_index, const MethodBinding & binding); // Generate setter script file and binding code for a property
@@ -126,34 +213,102 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator
   FString               generate_property_getter_binding_code(UProperty * property_p, const FString & class_name_cpp, UClass * class_p, const MethodBinding & binding); // Generate getter binding code for a property
   FString               generate_property_setter_binding_code(UProperty * property_p, const FString & class_name_cpp, UClass * class_p, const MethodBinding & binding); // Generate setter binding code for a property
 
+  FString               generate_batch_method(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding); // Generate script file and binding code for the batched variant of an instance method
+  FString               generate_batch_property_accessor(const FString & class_name_cpp, UClass * class_p, UProperty * property_p, bool is_setter, const MethodBinding & binding); // Generate script file and binding code for the batched variant of a property getter or setter
+  void                  generate_batch_script_file(UClass * class_p, const FString & script_function_name, const FString & params, const FString & return_type_name); // Generate script file for a batched binding
+  FString               get_batch_array_type_name(UProperty * property_p) const; // C++ type of the native array a batched binding unpacks a list argument into
+
+  FString               generate_coroutine(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding); // Generate script file and binding code for a coroutine wrapping a latent function
+  void                  generate_entity_coroutine_file(); // Generate binding file for coroutines of static latent functions gathered during export
+  FString               generate_property_snapshot(const FString & class_name_cpp, UClass * class_p, const TArray<UProperty *> & properties, bool is_apply, const MethodBinding & binding); // Generate script file and binding code transferring several properties in one call
+  FString               generate_event_subscription(const FString & class_name_cpp, UClass * class_p, UMulticastDelegateProperty * property_p, const MethodBinding & subscribe_binding, const MethodBinding & unsubscribe_binding); // Generate script files and binding code to subscribe script handlers to a multicast delegate
+
   FString               generate_method_binding_declaration(const FString & function_name, bool is_static); // Generate declaration of method binding function
+  FString               generate_binding_instrumentation(UClass * class_p, const MethodBinding & binding); // Generate code that counts calls and cycles of a binding - empty if instrumentation is off
   FString               generate_this_pointer_initialization(const FString & class_name_cpp, UClass * class_p, bool is_static); // Generate code that obtains the 'this' pointer from scope_p
+  FString               generate_this_pointer_assert(const FString & message); // Generate statement asserting that this_p is not null
+  FString               generate_this_pointer_test(); // Generate condition guarding use of this_p
+  FString               generate_function_lookup(UFunction * function_p, bool is_thread_safe); // Generate declaration of local function_p
+  FString               generate_property_lookup(UClass * class_p, UProperty * property_p); // Generate declaration of local property_p
   FString               generate_method_parameter_expression(UFunction * function_p, UProperty * param_p, int32 ParamIndex);
   FString               generate_property_default_ctor_argument(UProperty * param_p);
 
   FString               generate_return_value_passing(UClass * class_p, UFunction * function_p, UProperty * return_value_p, const FString & return_value_name); // Generate code that passes back the return value
 
   void                  generate_master_binding_file(); // Generate master source file that includes all others
+  void                  generate_descriptor_thunk_file(); // Generate header with the descriptor table types and the shared invocation thunk
+  void                  generate_marshal_traits_file(); // Generate header with the SkMarshal<> traits all bindings use to convert arguments and results
+  void                  generate_batch_helper_file(); // Generate header with the list packing helpers used by batched bindings
+  void                  generate_binding_stats_file(); // Generate header with the binding instrumentation types and report function
+  void                  generate_binding_profile_file(); // Generate header with the macros that differ between development and shipping bindings
+  void                  generate_thread_safety_file(); // Generate header with the registry of thread safe bindings
+  void                  generate_delegate_listener_file(); // Generate header specifying the runtime interface the event bindings call into
+  void                  generate_latent_callback_file(); // Generate header specifying the runtime interface the coroutine bindings call into
+  void                  generate_wrapper_cache_file(); // Generate header with the cache of script instances wrapping UObjects
 
   bool                  can_export_class(UClass * class_p, const FString & source_header_file_name) const;
-  static bool           can_export_method(UClass * class_p, UFunction * function_p);
-  static bool           can_export_property(UClass * class_p, UProperty * property_p);
+  bool                  can_export_method(UClass * class_p, UFunction * function_p) const;
+  bool                  can_export_property(UClass * class_p, UProperty * property_p) const;
+  bool                  can_use_method_descriptor(UFunction * function_p) const;
+  bool                  can_export_event(UClass * class_p, UProperty * property_p) const;
+  static bool           is_latent_function(UFunction * function_p);
+  static bool           is_out_param(UProperty * param_p); // If a parameter is only written by the function
+  bool                  is_return_arg_param(UProperty * param_p) const; // If a parameter is passed back to script as a return argument
+  bool                  has_return_arg_params(UFunction * function_p) const;
+  bool                  is_thread_safe_function(UFunction * function_p) const; // If the binding of a function may be invoked from any thread
+  bool                  is_memoized_function(UFunction * function_p) const; // If the binding of a function caches its result for the current frame
+  static UProperty *    get_latent_info_param(UFunction * function_p);
   static bool           does_class_have_static_class(UClass * class_p);
-  static bool           is_property_type_supported(UProperty * property_p);
+  static bool           can_export_struct(UScriptStruct * struct_p);
+  static FString        get_struct_include_path(UScriptStruct * struct_p); // Path to include the header declaring a struct, empty if unknown
+  bool                  is_property_type_supported(UProperty * property_p) const;
+  bool                  is_property_read_in_place(UProperty * property_p) const;
 
+  static bool           is_reserved_keyword(const FString & name);
   static FString        skookify_class_name(const FString & name);
   static FString        skookify_var_name(const FString & name, bool * is_boolean_p = nullptr);
   static FString        skookify_method_name(const FString & name, UProperty * return_property_p = nullptr);
   static FString        get_skookum_class_name(UClass * class_p);
   FString               get_skookum_class_path(UClass * class_p);
   FString               get_skookum_method_path(UClass * class_p, const FString & script_function_name, bool is_static);
-  static eSkTypeID      get_skookum_property_type(UProperty * property_p);
+  eSkTypeID             get_skookum_property_type(UProperty * property_p) const;
   FString               get_skookum_property_type_name(UProperty * property_p);
+  FString               get_skookum_binding_class_name(UProperty * property_p);
   static uint32         get_skookum_string_crc(const FString & string);
   FString               get_cpp_class_name(UClass * class_p);
   static FString        get_cpp_property_type_name(UProperty * property_p, uint32 port_flags = 0);
-
+  static FString        get_cpp_array_element_type_name(UProperty * inner_property_p, uint32 port_flags); // Exact element type of a TArray, keeping TSubclassOf<> so the array layout matches the native one
+
+  void                  snapshot_class(UClass * class_p, const FString & source_header_file_name); // Append reflection data of a class to the snapshot
+  void                  snapshot_property(FArchive & ar, UProperty * property_p); // Write reflection data of a property or parameter
+  void                  snapshot_struct(FArchive & ar, UScriptStruct * struct_p); // Write reflection data of a struct and its fields
+  void                  snapshot_enum(FArchive & ar, UEnum * enum_p); // Write reflection data of an enum and its values
+  void                  snapshot_meta_data(FArchive & ar, UField * field_p); // Write those of ms_snapshot_meta_data_keys a field has
+  void                  snapshot_name(FArchive & ar, const FString & name); // Write index of a name, adding it to the string table if new
+  void                  save_reflection_snapshot(); // Write string table and all class, struct and enum records to disk
+  void                  verify_reflection_snapshot(const FString & file_path); // Read a snapshot back and check it against what has been written
+  static FString        read_snapshot_name(FArchive & ar, const TArray<FString> & names); // Read a name index and look it up
+  static void           read_snapshot_meta_data(FArchive & ar, const TArray<FString> & names);
+  static void           read_snapshot_property(FArchive & ar, const TArray<FString> & names);
+  void                  add_signature(const FString & file_path, const FString & text); // Append a script file to the signature database
+  void                  signature_name(FArchive & ar, const FString & name); // Write index of a name, adding it to the signature string table if new
+  void                  load_signature_database(const FString & file_path); // Append the records of a shard's signature database
+  void                  save_signature_database(); // Write string table and all signature records next to the script files
+
+  static bool           save_text_file(const FString & text, const FString & file_path); // Write text as UTF-8, converting it chunk by chunk
+  static bool           save_utf8_file(const ANSICHAR * text_p, int32 length, const FString & file_path); // Write already converted text
+  static bool           is_file_equal(const FString & file_path, const ANSICHAR * text_p, int32 length); // Compare file contents, bailing out at the first difference
+  void                  load_file_hashes();
+  void                  save_file_hashes();
+  bool                  is_class_in_shard(UClass * class_p) const; // If this shard generates the given class
+  FString               get_shard_file_name(const FString & file_name) const; // Per-shard variant of a file that every process would otherwise write
+  void                  save_shard_manifest(); // Write what this shard generated and used so the merge step can continue from there
+  void                  load_shard_manifests(); // Pick up the results of all shards in the merge step
   bool                  save_header_if_changed(const FString & HeaderPath, const FString & new_header_contents); // Helper to change a file only if needed
+  bool                  has_file_changed(const FString & file_path, const ANSICHAR * text_p, int32 length, uint32 * crc_p); // Compare against the file on disk, also returning the hash of the new contents
+  void                  record_file_hash(const FString & file_path, uint32 crc, int64 size); // Remember what a file on disk contains - only once it has been written
+  bool                  save_script_file(const FString & text, const FString & file_path); // Write a script file unless it already has this content
+  void                  delete_stale_script_files(); // Remove script files and folders not generated in this run
   void                  rename_temp_files(); // Puts generated files into place after all code generation is done
   };
 
@@ -191,9 +346,40 @@ void FSkookumScriptGenerator::Initialize(const FString & root_local_path, const
   m_runtime_plugin_root_path = include_base;
   m_scripts_path = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*(include_base / TEXT("../../Scripts/Engine-Generated")));
 
-  // Clear contents of scripts folder for a fresh start
-  FString directory_to_delete(m_scripts_path / TEXT("Object"));
-  IFileManager::Get().DeleteDirectory(*directory_to_delete, false, true);
+  // Fetch from command line if this process is one of several splitting up the generation work
+  // -SkookumShard=Index/Count   Generate the classes hashing to Index and write what was used to a shard manifest
+  // -SkookumShardMerge=Count    Run after all shards: generate used extra classes, structs, support and master files from the manifests
+  m_shard_count = 0;
+  m_shard_index = -1;
+  FString shard_arg, shard_index, shard_count;
+  if (FParse::Value(FCommandLine::Get(), TEXT("SkookumShard="), shard_arg) && shard_arg.Split(TEXT("/"), &shard_index, &shard_count))
+    {
+    m_shard_index = FCString::Atoi(*shard_index);
+    m_shard_count = FCString::Atoi(*shard_count);
+    if (m_shard_count <= 0 || m_shard_index < 0 || m_shard_index >= m_shard_count)
+      {
+      FError::Throwf(TEXT("Invalid shard: %s"), *shard_arg);
+      }
+    }
+  else
+    {
+    FParse::Value(FCommandLine::Get(), TEXT("SkookumShardMerge="), m_shard_count);
+    }
+
+  // Fetch from ini file if script files shall be updated in place rather than regenerated from scratch
+  // [SkookumScriptGenerator]
+  // UpdateScriptsInPlace=True
+  m_update_scripts_in_place = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("UpdateScriptsInPlace"), m_update_scripts_in_place, GEngineIni);
+  m_script_file_paths.Reset();
+
+  // Clear contents of scripts folder for a fresh start - when sharded, whoever launches the shards must do this beforehand
+  // When updating in place, unchanged files are kept and stale ones removed in FinishExport() instead
+  if (m_shard_count == 0 && !m_update_scripts_in_place)
+    {
+    FString directory_to_delete(m_scripts_path / TEXT("Object"));
+    IFileManager::Get().DeleteDirectory(*directory_to_delete, false, true);
+    }
 
   // Try to figure the path depth from ini file
   m_scripts_path_depth = 4; // Set to sensible default in case we don't find it in the ini file
@@ -222,6 +408,142 @@ void FSkookumScriptGenerator::Initialize(const FString & root_local_path, const
   // +SkipClasses=ClassName2
   GConfig->GetArray(TEXT("SkookumScriptGenerator"), TEXT("SkipClasses"), m_skip_classes, GEngineIni);
 
+  // Fetch from ini file which properties of which classes shall be read and written in bulk
+  // [SkookumScriptGenerator]
+  // +PropertySnapshots=ClassName1:PropertyName1,PropertyName2
+  TArray<FString> property_snapshots;
+  GConfig->GetArray(TEXT("SkookumScriptGenerator"), TEXT("PropertySnapshots"), property_snapshots, GEngineIni);
+  m_property_snapshots.Reset();
+  for (auto & property_snapshot : property_snapshots)
+    {
+    FString class_name, property_names;
+    if (property_snapshot.Split(TEXT(":"), &class_name, &property_names))
+      {
+      property_names.ParseIntoArray(m_property_snapshots.FindOrAdd(class_name.Trim().TrimTrailing()), TEXT(","), true);
+      }
+    }
+
+  // Fetch from ini file which pure functions without arguments shall remember their result per object until the next frame
+  // [SkookumScriptGenerator]
+  // +MemoizedFunctions=ClassName1:FunctionName1,FunctionName2
+  // +MemoizedFunctions=ClassName2:*
+  TArray<FString> memoized_functions;
+  GConfig->GetArray(TEXT("SkookumScriptGenerator"), TEXT("MemoizedFunctions"), memoized_functions, GEngineIni);
+  m_memoized_functions.Reset();
+  for (auto & memoized_function : memoized_functions)
+    {
+    FString class_name, function_names;
+    if (memoized_function.Split(TEXT(":"), &class_name, &function_names))
+      {
+      function_names.ParseIntoArray(m_memoized_functions.FindOrAdd(class_name.Trim().TrimTrailing()), TEXT(","), true);
+      }
+    }
+
+  m_has_coroutines = false;
+
+  load_file_hashes();
+
+  // Fetch from ini file if methods shall be bound via compact descriptor tables
+  // [SkookumScriptGenerator]
+  // UseDescriptorTables=True
+  m_use_descriptor_tables = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("UseDescriptorTables"), m_use_descriptor_tables, GEngineIni);
+
+  // Fetch from ini file if batched variants of instance methods and property accessors shall be generated
+  // [SkookumScriptGenerator]
+  // GenerateBatchBindings=True
+  m_generate_batch_bindings = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateBatchBindings"), m_generate_batch_bindings, GEngineIni);
+
+  // Fetch from ini file if event subscription methods shall be generated for multicast delegates
+  // The runtime plugin has to implement the SkUEDelegateListener interface declared in SkUEDelegateListener.generated.hpp
+  // [SkookumScriptGenerator]
+  // GenerateEventBindings=True
+  m_generate_event_bindings = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateEventBindings"), m_generate_event_bindings, GEngineIni);
+
+  // Fetch from ini file if latent functions shall be bound as coroutines - otherwise they are skipped
+  // The runtime plugin has to implement the SkUELatentCallback interface declared in SkUELatentCallback.generated.hpp
+  // [SkookumScriptGenerator]
+  // GenerateCoroutines=True
+  m_generate_coroutines = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateCoroutines"), m_generate_coroutines, GEngineIni);
+
+  // Fetch from ini file if out parameters shall become return arguments, e.g. "(Boolean complex; HitResult out_hit) Boolean"
+  // This changes the signature of every method with out parameters, so calls in existing scripts have to be updated
+  // [SkookumScriptGenerator]
+  // ReturnOutParams=True
+  m_return_out_params = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("ReturnOutParams"), m_return_out_params, GEngineIni);
+
+  // Fetch from ini file if bindings shall count their calls and cycles
+  // [SkookumScriptGenerator]
+  // InstrumentBindings=True
+  m_instrument_bindings = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("InstrumentBindings"), m_instrument_bindings, GEngineIni);
+
+  // Fetch from ini file if bindings shall be generated with a lean shipping flavor
+  // [SkookumScriptGenerator]
+  // GenerateShippingProfile=True
+  m_generate_shipping_profile = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateShippingProfile"), m_generate_shipping_profile, GEngineIni);
+
+  // Fetch from ini file if UObject return values shall reuse their script wrappers
+  // [SkookumScriptGenerator]
+  // CacheObjectWrappers=True
+  m_cache_object_wrappers = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("CacheObjectWrappers"), m_cache_object_wrappers, GEngineIni);
+
+  // Fetch from ini file if the ThreadSafeFunctions below shall get bindings that can run on worker threads
+  // [SkookumScriptGenerator]
+  // GenerateThreadSafeBindings=True
+  m_generate_thread_safe_bindings = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateThreadSafeBindings"), m_generate_thread_safe_bindings, GEngineIni);
+
+  // Fetch from ini file which static functions are known not to touch any shared state - function flags can't tell
+  // [SkookumScriptGenerator]
+  // +ThreadSafeFunctions=KismetMathLibrary:Add_VectorVector,Dot_VectorVector
+  TArray<FString> thread_safe_functions;
+  GConfig->GetArray(TEXT("SkookumScriptGenerator"), TEXT("ThreadSafeFunctions"), thread_safe_functions, GEngineIni);
+  m_thread_safe_functions.Reset();
+  for (auto & thread_safe_function : thread_safe_functions)
+    {
+    FString class_name, function_names;
+    if (thread_safe_function.Split(TEXT(":"), &class_name, &function_names))
+      {
+      function_names.ParseIntoArray(m_thread_safe_functions.FindOrAdd(class_name.Trim().TrimTrailing()), TEXT(","), true);
+      }
+    }
+
+  // Fetch from ini file if arbitrary USTRUCTs shall be bound as value types
+  // [SkookumScriptGenerator]
+  // GenerateStructBindings=True
+  m_generate_struct_bindings = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("GenerateStructBindings"), m_generate_struct_bindings, GEngineIni);
+
+  // Fetch from ini file if a binary snapshot of the reflection data shall be written for offline generation
+  // [SkookumScriptGenerator]
+  // WriteReflectionSnapshot=True
+  m_write_reflection_snapshot = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("WriteReflectionSnapshot"), m_write_reflection_snapshot, GEngineIni);
+  m_reflection_snapshot_data.Reset();
+  m_reflection_snapshot_class_count = 0;
+  m_reflection_snapshot_structs.Reset();
+  m_reflection_snapshot_enums.Reset();
+  m_reflection_snapshot_names.Reset();
+  m_reflection_snapshot_name_indices.Reset();
+
+  // Fetch from ini file if the signatures of all script files shall also be written to a binary database the compiler can load in one go
+  // [SkookumScriptGenerator]
+  // WriteSignatureDatabase=True
+  m_write_signature_database = false;
+  GConfig->GetBool(TEXT("SkookumScriptGenerator"), TEXT("WriteSignatureDatabase"), m_write_signature_database, GEngineIni);
+  m_signature_data.Reset();
+  m_signature_count = 0;
+  m_signature_names.Reset();
+  m_signature_name_indices.Reset();
+  m_signature_file_paths.Reset();
+
   // Create debug log file
 #ifdef USE_DEBUG_LOG_FILE
   m_debug_log_file = _wfopen(*(output_directory / TEXT("SkookumScriptGenerator.log.txt")), TEXT("w"));
@@ -254,6 +576,12 @@ bool FSkookumScriptGenerator::ShouldExportClassesForModule(const FString & modul
 
 void FSkookumScriptGenerator::ExportClass(UClass * class_p, const FString & source_header_file_name, const FString & generated_header_file_name, bool has_changed)
   {
+  // Record everything UHT hands us so an offline run can apply the same filters
+  if (m_write_reflection_snapshot)
+    {
+    snapshot_class(class_p, source_header_file_name);
+    }
+
   // $Revisit MBreyer - (for now) skip and forget classes coming from engine plugins
   if (source_header_file_name.Find(TEXT("Engine/Plugins")) >= 0
     || source_header_file_name.Find(TEXT("Engine\\Plugins")) >= 0)
@@ -267,6 +595,12 @@ void FSkookumScriptGenerator::ExportClass(UClass * class_p, const FString & sour
     return;
     }
 
+  // When sharded, other processes take care of the classes outside our slice
+  if (m_shard_count > 0 && !is_class_in_shard(class_p))
+    {
+    return;
+    }
+
   generate_class(class_p, source_header_file_name);
   }
 
@@ -274,6 +608,27 @@ void FSkookumScriptGenerator::ExportClass(UClass * class_p, const FString & sour
 
 void FSkookumScriptGenerator::FinishExport()
   {
+  // A shard only reports back - everything depending on the full set of classes is up to the merge step
+  if (m_shard_index >= 0)
+    {
+    save_shard_manifest();
+    rename_temp_files();
+    if (m_write_signature_database)
+      {
+      save_signature_database();
+      }
+    save_file_hashes();
+    if (m_write_reflection_snapshot)
+      {
+      save_reflection_snapshot();
+      }
+    return;
+    }
+  if (m_shard_count > 0)
+    {
+    load_shard_manifests();
+    }
+
   // Generate any classes that have been used but not exported yet
   for (auto & extra_class : m_extra_classes)
     {
@@ -301,8 +656,74 @@ void FSkookumScriptGenerator::FinishExport()
       }
     }
 
+  // Generate value type classes for all structs used so far - their fields can in turn use more structs and classes
+  for (int32 struct_index = 0; struct_index < m_used_structs.Num(); ++struct_index)
+    {
+    generate_struct(m_used_structs[struct_index]);
+
+    // Once all structs known so far are done, pick up classes only used by them
+    if (struct_index == m_used_structs.Num() - 1)
+      {
+      for (auto & extra_class : m_extra_classes)
+        {
+        if (m_used_classes.Find(extra_class.m_class_p) >= 0 && !m_exported_classes.Contains(extra_class.m_class_p))
+          {
+          generate_class(extra_class.m_class_p, extra_class.m_source_header_file_name);
+          }
+        }
+      }
+    }
+
+  if (m_entity_coroutine_bindings.Num() > 0)
+    {
+    generate_entity_coroutine_file();
+    }
+  generate_marshal_traits_file();
+  if (m_cache_object_wrappers)
+    {
+    generate_wrapper_cache_file();
+    }
+  if (m_use_descriptor_tables)
+    {
+    generate_descriptor_thunk_file();
+    }
+  if (m_generate_batch_bindings)
+    {
+    generate_batch_helper_file();
+    }
+  if (m_instrument_bindings)
+    {
+    generate_binding_stats_file();
+    }
+  if (m_generate_shipping_profile)
+    {
+    generate_binding_profile_file();
+    }
+  if (m_generate_thread_safe_bindings)
+    {
+    generate_thread_safety_file();
+    }
+  if (m_generate_event_bindings)
+    {
+    generate_delegate_listener_file();
+    }
+  if (m_has_coroutines)
+    {
+    generate_latent_callback_file();
+    }
   generate_master_binding_file();
   rename_temp_files();
+  delete_stale_script_files();
+  if (m_write_signature_database)
+    {
+    save_signature_database();
+    }
+  save_file_hashes();
+
+  if (m_write_reflection_snapshot)
+    {
+    save_reflection_snapshot();
+    }
 
 #ifdef USE_DEBUG_LOG_FILE
   fclose(m_debug_log_file);
@@ -337,9 +758,44 @@ const FString FSkookumScriptGenerator::ms_sk_type_id_names[FSkookumScriptGenerat
   TEXT("Color"),
   TEXT("EntityClass"),  // UClass
   TEXT("Entity"),       // UObject
+  TEXT("UStruct"),      // Any other USTRUCT - get_skookum_property_type_name() returns the specific one
+  TEXT("List"),         // TArray
+  };
+
+const FString FSkookumScriptGenerator::ms_sk_type_id_binding_class_names[FSkookumScriptGenerator::SkTypeID__Count] =
+  {
+  TEXT(""),
+  TEXT("SkInteger"),
+  TEXT("SkReal"),
+  TEXT("SkBoolean"),
+  TEXT("SkString"),
+  TEXT("SkUEName"),
+  TEXT("SkVector2"),
+  TEXT("SkVector3"),
+  TEXT("SkVector4"),
+  TEXT("SkRotation"),
+  TEXT("SkRotationAngles"),
+  TEXT("SkTransform"),
+  TEXT("SkColor"),
+  TEXT("SkUEEntityClass"),
+  TEXT("SkUEEntity"),       // Generic binding - get_skookum_binding_class_name() returns the specific one
+  TEXT(""),                 // No generic binding - get_skookum_binding_class_name() returns the generated one
+  TEXT("SkList"),           // Generic binding - get_skookum_binding_class_name() returns SkUEList<> with the element type
+  };
+
+const TCHAR * const FSkookumScriptGenerator::ms_snapshot_meta_data_keys[] =
+  {
+  TEXT("BlueprintType"),
+  TEXT("DeprecatedFunction"),
+  TEXT("DisplayName"),
+  TEXT("Latent"),
+  TEXT("LatentInfo"),
+  TEXT("ModuleRelativePath"),
+  TEXT("ScriptName"),
+  TEXT("WorldContext"),
   };
 
-const FString FSkookumScriptGenerator::ms_reserved_keywords[] =
+const TCHAR * const FSkookumScriptGenerator::ms_reserved_keywords[] =
   {
   TEXT("branch"),
   TEXT("case"),
@@ -404,7 +860,7 @@ void FSkookumScriptGenerator::generate_class_script_files(UClass * class_p)
   {
   // Create class meta file:
   FString meta_file_path = get_skookum_class_path(class_p) / TEXT("!Class.sk-meta");
-  if (!FFileHelper::SaveStringToFile(FString(), *meta_file_path))
+  if (!save_script_file(FString(), meta_file_path))
     {
     FError::Throwf(TEXT("Could not save file: %s"), *meta_file_path);
     }
@@ -462,22 +918,93 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
 
   enum eScope { Scope_instance, Scope_class }; // 0 = instance, 1 = static bindings
   TArray<MethodBinding> bindings[2]; // eScope
+  TArray<MethodBinding> coroutine_bindings;
   MethodBinding binding;
 
+  // Descriptor table parts, only used if m_use_descriptor_tables is set
+  FString descriptor_declarations;
+  FString descriptor_rows;
+  int32 descriptor_count = 0;
+
+  // Static methods get invoked on the class default object which is looked up once at registration time
+  bool has_static_methods = false;
+  for (TFieldIterator<UFunction> FuncIt(class_p); FuncIt && !has_static_methods; ++FuncIt)
+    {
+    has_static_methods = FuncIt->HasAnyFunctionFlags(FUNC_Static) && can_export_method(class_p, *FuncIt);
+    }
+
   FString generated_code;
   generated_code += FString::Printf(TEXT("\r\nnamespace SkUE%s_Impl\r\n  {\r\n\r\n"), *skookum_class_name);
 
+  if (has_static_methods)
+    {
+    generated_code += TEXT("  static UObject * default_object_p = nullptr; // Class default object, set in register_bindings()\r\n\r\n");
+    }
+
+  // Instrumentation counters get declared here once we know how many bindings there are
+  m_binding_stat_names.Reset();
+  m_function_lookup_names.Reset();
+  m_property_lookup_names.Reset();
+  m_thread_safe_method_names.Reset();
+  const int32 binding_stats_pos = generated_code.Len();
+
   // Export all functions
   for (TFieldIterator<UFunction> FuncIt(class_p /*, EFieldIteratorFlags::ExcludeSuper */); FuncIt; ++FuncIt)
     {
     UFunction * function_p = *FuncIt;
-    if (can_export_method(class_p, function_p))
+    if (can_export_method(class_p, function_p) && is_latent_function(function_p))
+      { // Latent functions become coroutines that complete when their latent action does
+      binding.make_coroutine(function_p);
+      TArray<MethodBinding> & target_bindings = function_p->HasAnyFunctionFlags(FUNC_Static) ? m_entity_coroutine_bindings : coroutine_bindings;
+      if (target_bindings.Find(binding) < 0)
+        {
+        FString coroutine_code = generate_coroutine(class_name_cpp, class_p, function_p, binding);
+        if (function_p->HasAnyFunctionFlags(FUNC_Static))
+          {
+          m_entity_coroutine_code += coroutine_code;
+          m_entity_coroutine_code_lengths.Add(coroutine_code.Len());
+          }
+        else
+          {
+          generated_code += coroutine_code;
+          }
+        target_bindings.Push(binding);
+        m_has_coroutines = true;
+        }
+      }
+    else if (can_export_method(class_p, function_p))
       {
       binding.make_method(function_p);
       if (bindings[Scope_instance].Find(binding) < 0 && bindings[Scope_class].Find(binding) < 0) // If method with this name already bound, assume it does the same thing and skip
         {
-        generated_code += generate_method(class_name_cpp, class_p, function_p, binding);
+        // Descriptor table rows resolve their function lazily, so thread safe methods always get their own binding
+        const bool is_thread_safe = is_thread_safe_function(function_p);
+        if (is_thread_safe)
+          {
+          m_thread_safe_method_names.Add(binding.m_script_name);
+          }
+        if (m_use_descriptor_tables && can_use_method_descriptor(function_p) && !is_thread_safe && !is_memoized_function(function_p))
+          {
+          binding.m_descriptor_index = descriptor_count++;
+          generate_method_script_file(function_p, binding.m_script_name);
+          generate_method_descriptor(class_p, function_p, binding, &descriptor_declarations, &descriptor_rows);
+          }
+        else
+          {
+          generated_code += generate_method(class_name_cpp, class_p, function_p, binding);
+          }
         bindings[function_p->HasAnyFunctionFlags(FUNC_Static) ? Scope_class : Scope_instance].Push(binding);
+
+        // A batch variant would have to pass back a list per out parameter - not supported, so no batch variant rather than one taking them as inputs
+        if (m_generate_batch_bindings && !function_p->HasAnyFunctionFlags(FUNC_Static) && !has_return_arg_params(function_p))
+          {
+          binding.make_batch();
+          if (bindings[Scope_instance].Find(binding) < 0 && bindings[Scope_class].Find(binding) < 0)
+            {
+            generated_code += generate_batch_method(class_name_cpp, class_p, function_p, binding);
+            bindings[Scope_class].Push(binding);
+            }
+          }
         }
       }
     }
@@ -496,6 +1023,16 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
         { // Only generate property accessor if not covered by a method already
         generated_code += generate_property_getter(class_name_cpp, class_p, property_p, property_index, binding);
         bindings[Scope_instance].Push(binding);
+
+        if (m_generate_batch_bindings)
+          {
+          binding.make_batch();
+          if (bindings[Scope_instance].Find(binding) < 0 && bindings[Scope_class].Find(binding) < 0)
+            {
+            generated_code += generate_batch_property_accessor(class_name_cpp, class_p, property_p, false, binding);
+            bindings[Scope_class].Push(binding);
+            }
+          }
         }
 
       if (property_p->PropertyFlags & CPF_Edit)
@@ -505,8 +1042,95 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
           { // Only generate property accessor if not covered by a method already
           generated_code += generate_property_setter(class_name_cpp, class_p, property_p, property_index, binding);
           bindings[Scope_instance].Push(binding);
+
+          if (m_generate_batch_bindings)
+            {
+            binding.make_batch();
+            if (bindings[Scope_instance].Find(binding) < 0 && bindings[Scope_class].Find(binding) < 0)
+              {
+              generated_code += generate_batch_property_accessor(class_name_cpp, class_p, property_p, true, binding);
+              bindings[Scope_class].Push(binding);
+              }
+            }
+          }
+        }
+      }
+    else if (m_generate_event_bindings && can_export_event(class_p, property_p))
+      {
+      MethodBinding unsubscribe_binding;
+      binding.make_event_method(property_p, TEXT("_subscribe"));
+      unsubscribe_binding.make_event_method(property_p, TEXT("_unsubscribe"));
+      if (bindings[Scope_instance].Find(binding) < 0 && bindings[Scope_instance].Find(unsubscribe_binding) < 0)
+        {
+        generated_code += generate_event_subscription(class_name_cpp, class_p, CastChecked<UMulticastDelegateProperty>(property_p), binding, unsubscribe_binding);
+        bindings[Scope_instance].Push(binding);
+        bindings[Scope_instance].Push(unsubscribe_binding);
+        }
+      }
+    }
+
+  // Bulk property transfer if configured for this class
+  const TArray<FString> * snapshot_property_names_p = m_property_snapshots.Find(class_p->GetName());
+  if (snapshot_property_names_p)
+    {
+    TArray<UProperty *> snapshot_properties;
+    TArray<UProperty *> apply_properties;
+    for (auto & property_name : *snapshot_property_names_p)
+      {
+      UProperty * property_p = FindField<UProperty>(class_p, *property_name.Trim().TrimTrailing());
+      if (!property_p || property_p->ArrayDim > 1 || !is_property_type_supported(property_p))
+        {
+        UE_LOG(LogSkookumScriptGenerator, Warning, TEXT("Property snapshot of %s: Skipping %s as it doesn't exist or its type is not supported."), *class_p->GetName(), *property_name);
+        continue;
+        }
+      snapshot_properties.Add(property_p);
+      if (property_p->PropertyFlags & CPF_Edit)
+        {
+        apply_properties.Add(property_p);
+        }
+      }
+
+    for (int32 is_apply = 0; is_apply < 2; ++is_apply)
+      {
+      const TArray<UProperty *> & properties = is_apply ? apply_properties : snapshot_properties;
+      binding.make_snapshot(!!is_apply);
+      if (properties.Num() > 0 && bindings[Scope_instance].Find(binding) < 0)
+        {
+        generated_code += generate_property_snapshot(class_name_cpp, class_p, properties, !!is_apply, binding);
+        bindings[Scope_instance].Push(binding);
+        }
+      }
+    }
+
+  // Descriptor table and the thunk that forwards each of its rows to the shared interpreter
+  if (descriptor_count > 0)
+    {
+    generated_code += descriptor_declarations;
+    generated_code += FString::Printf(TEXT("  static UFunction * function_cache[%d]; // Resolved on first invocation by SkUEDescriptorThunk\r\n\r\n"), descriptor_count);
+    generated_code += TEXT("  static const SkUEMethodDescriptor method_descriptors[] =\r\n    {\r\n");
+    generated_code += descriptor_rows;
+    generated_code += TEXT("    };\r\n\r\n");
+    if (m_instrument_bindings)
+      {
+      // Table rows get the stats slots following those of the unrolled bindings
+      generated_code += FString::Printf(TEXT("  template<int32 _Index> static void invoke_descriptor(SkInvokedMethod * scope_p, SkInstance ** result_pp) { SkUEBindingScope binding_scope(binding_stats[%d + _Index]); SkUEDescriptorThunk::invoke(method_descriptors[_Index], scope_p, result_pp); }\r\n\r\n"), m_binding_stat_names.Num());
+      TArray<FString> descriptor_stat_names;
+      descriptor_stat_names.SetNum(descriptor_count);
+      for (int32 scope = 0; scope < 2; ++scope)
+        {
+        for (auto & binding : bindings[scope])
+          {
+          if (binding.m_descriptor_index >= 0)
+            {
+            descriptor_stat_names[binding.m_descriptor_index] = skookum_class_name + TEXT("@") + binding.m_script_name;
+            }
           }
         }
+      m_binding_stat_names.Append(descriptor_stat_names);
+      }
+    else
+      {
+      generated_code += TEXT("  template<int32 _Index> static void invoke_descriptor(SkInvokedMethod * scope_p, SkInstance ** result_pp) { SkUEDescriptorThunk::invoke(method_descriptors[_Index], scope_p, result_pp); }\r\n\r\n");
       }
     }
 
@@ -518,11 +1142,67 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
       generated_code += FString::Printf(TEXT("  static const SkClass::MethodInitializerFuncId methods_%c[] =\r\n    {\r\n"), scope ? TCHAR('c') : TCHAR('i'));
       for (auto & binding : bindings[scope])
         {
-        generated_code += FString::Printf(TEXT("      { 0x%08x, mthd%s_%s },\r\n"), get_skookum_string_crc(*binding.m_script_name), scope ? TEXT("c") : TEXT(""), *binding.m_code_name);
+        if (binding.m_descriptor_index >= 0)
+          {
+          generated_code += FString::Printf(TEXT("      { 0x%08x, invoke_descriptor<%d> },\r\n"), get_skookum_string_crc(*binding.m_script_name), binding.m_descriptor_index);
+          }
+        else
+          {
+          generated_code += FString::Printf(TEXT("      { 0x%08x, mthd%s_%s },\r\n"), get_skookum_string_crc(*binding.m_script_name), scope ? TEXT("c") : TEXT(""), *binding.m_code_name);
+          }
         }
       generated_code += TEXT("    };\r\n\r\n");
       }
     }
+  if (coroutine_bindings.Num() > 0)
+    {
+    generated_code += TEXT("  static const SkClass::CoroutineInitializerFuncId coroutines_i[] =\r\n    {\r\n");
+    for (auto & binding : coroutine_bindings)
+      {
+      generated_code += FString::Printf(TEXT("      { 0x%08x, coro_%s },\r\n"), get_skookum_string_crc(*binding.m_script_name), *binding.m_code_name);
+      }
+    generated_code += TEXT("    };\r\n\r\n");
+    }
+
+  // Instrumentation counters and names, declared ahead of the bindings using them
+  if (m_binding_stat_names.Num() > 0)
+    {
+    FString binding_stats_code = FString::Printf(TEXT("  static SkUEBindingStat binding_stats[%d];\r\n"), m_binding_stat_names.Num());
+    binding_stats_code += TEXT("  static const TCHAR * const binding_stat_names[] =\r\n    {\r\n");
+    for (auto & stat_name : m_binding_stat_names)
+      {
+      binding_stats_code += FString::Printf(TEXT("    TEXT(\"%s\"),\r\n"), *stat_name);
+      }
+    binding_stats_code += TEXT("    };\r\n\r\n");
+    generated_code.InsertAt(binding_stats_pos, binding_stats_code);
+    }
+
+  // Lookups of the shipping profile, resolved once in register_bindings() instead of lazily on each call
+  if (m_function_lookup_names.Num() > 0 || m_property_lookup_names.Num() > 0)
+    {
+    FString lookups_code;
+    if (m_function_lookup_names.Num() > 0)
+      {
+      lookups_code += FString::Printf(TEXT("  static UFunction * function_ptrs[%d]; // Set in register_bindings()\r\n"), m_function_lookup_names.Num());
+      }
+    if (m_property_lookup_names.Num() > 0)
+      {
+      lookups_code += FString::Printf(TEXT("  static UProperty * property_ptrs[%d]; // Set in register_bindings()\r\n"), m_property_lookup_names.Num());
+      }
+    lookups_code += TEXT("\r\n");
+    generated_code.InsertAt(binding_stats_pos, lookups_code);
+    }
+
+  // Methods the runtime may schedule on worker threads
+  if (m_thread_safe_method_names.Num() > 0)
+    {
+    generated_code += TEXT("  static const uint32 thread_safe_method_ids[] =\r\n    {\r\n");
+    for (auto & method_name : m_thread_safe_method_names)
+      {
+      generated_code += FString::Printf(TEXT("    0x%08x, // \"%s\"\r\n"), get_skookum_string_crc(method_name), *method_name);
+      }
+    generated_code += TEXT("    };\r\n\r\n");
+    }
 
   // Close namespace
   generated_code += FString::Printf(TEXT("  } // SkUE%s_Impl\r\n\r\n"), *skookum_class_name);
@@ -539,7 +1219,20 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
     }
   else
     {
-    generated_code += FString::Printf(TEXT("  ms_uclass_p = FindObject<UClass>(ANY_PACKAGE, TEXT(\"%s\"));\r\n"), *class_p->GetName());
+    generated_code += TEXT("  // ms_uclass_p has already been resolved by SkUE::resolve_uclasses()\r\n");
+    }
+
+  if (has_static_methods)
+    {
+    generated_code += FString::Printf(TEXT("  SkUE%s_Impl::default_object_p = GetMutableDefault<UObject>(ms_uclass_p);\r\n"), *skookum_class_name);
+    }
+  for (int32 i = 0; i < m_function_lookup_names.Num(); ++i)
+    {
+    generated_code += FString::Printf(TEXT("  SkUE%s_Impl::function_ptrs[%d] = ms_uclass_p->GetDefaultObject()->FindFunctionChecked(FName(TEXT(\"%s\")));\r\n"), *skookum_class_name, i, *m_function_lookup_names[i]);
+    }
+  for (int32 i = 0; i < m_property_lookup_names.Num(); ++i)
+    {
+    generated_code += FString::Printf(TEXT("  SkUE%s_Impl::property_ptrs[%d] = SkUEClassBindingHelper::find_class_property(ms_uclass_p, TEXT(\"%s\"));\r\n"), *skookum_class_name, i, *m_property_lookup_names[i]);
     }
 
   for (uint32 scope = 0; scope < 2; ++scope)
@@ -549,6 +1242,18 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
       generated_code += FString::Printf(TEXT("  ms_class_p->register_method_func_bulk(SkUE%s_Impl::methods_%c, %d, %s);\r\n"), *skookum_class_name, scope ? TCHAR('c') : TCHAR('i'), bindings[scope].Num(), scope ? TEXT("SkBindFlag_class_no_rebind") : TEXT("SkBindFlag_instance_no_rebind"));
       }
     }
+  if (m_binding_stat_names.Num() > 0)
+    {
+    generated_code += FString::Printf(TEXT("  SkUEBindingStats::register_stats(SkUE%s_Impl::binding_stats, SkUE%s_Impl::binding_stat_names, %d);\r\n"), *skookum_class_name, *skookum_class_name, m_binding_stat_names.Num());
+    }
+  if (coroutine_bindings.Num() > 0)
+    {
+    generated_code += FString::Printf(TEXT("  ms_class_p->register_coroutine_func_bulk(SkUE%s_Impl::coroutines_i, %d, SkBindFlag_instance_no_rebind);\r\n"), *skookum_class_name, coroutine_bindings.Num());
+    }
+  if (m_thread_safe_method_names.Num() > 0)
+    {
+    generated_code += FString::Printf(TEXT("  SkUEThreadSafety::register_methods(0x%08x, SkUE%s_Impl::thread_safe_method_ids, %d);\r\n"), get_skookum_string_crc(*skookum_class_name), *skookum_class_name, m_thread_safe_method_names.Num());
+    }
   generated_code += TEXT("  }\r\n");
 
   save_header_if_changed(m_binding_code_path / class_binding_file_name, generated_code);
@@ -556,44 +1261,197 @@ void FSkookumScriptGenerator::generate_class_binding_file(UClass * class_p)
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::generate_method(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding)
+void FSkookumScriptGenerator::generate_struct(UScriptStruct * struct_p)
   {
-  // Generate script file
-  generate_method_script_file(function_p, binding.m_script_name);
+  const FString skookum_struct_name = skookify_class_name(struct_p->GetName());
+  const FString struct_name_cpp = FString::Printf(TEXT("%s%s"), struct_p->GetPrefixCPP(), *struct_p->GetName());
+  const FString struct_path = m_scripts_path / TEXT("Object") / skookum_struct_name;
 
-  // Generate binding code
-  return generate_method_binding_code(class_name_cpp, class_p, function_p, binding);
-  }
+  UE_LOG(LogSkookumScriptGenerator, Log, TEXT("Generating struct %s"), *skookum_struct_name);
 
-//---------------------------------------------------------------------------------------
+  m_exported_structs.Add(struct_p);
 
-void FSkookumScriptGenerator::generate_method_script_file(UFunction * function_p, const FString & script_function_name)
-  {
-  // Generate function content
-  FString function_body;
-  function_body.Reserve(1024);
-  bool has_params_or_return_value = (function_p->Children != NULL);
-  if (has_params_or_return_value)
+  // Create class meta file
+  FString meta_file_path = struct_path / TEXT("!Class.sk-meta");
+  if (!save_script_file(FString(), meta_file_path))
     {
-    function_body += TEXT("(");
+    FError::Throwf(TEXT("Could not save file: %s"), *meta_file_path);
+    }
 
-    FString separator;
-    FString return_type_name;
-    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
-      {
-      UProperty * param_p = *param_it;
-      if (param_p->GetPropertyFlags() & CPF_ReturnParm)
-        {
-        return_type_name = TEXT(" ") + get_skookum_property_type_name(param_p);
-        }
-      else
-        {
-        function_body += separator + get_skookum_property_type_name(param_p) + TEXT(" ") + skookify_var_name(param_p->GetName());
-        }
-      separator = TEXT(", ");
-      }
+  // Header - plain old data is zero-initialized and, if small enough, lives right inside the instance's user data
+  const FString struct_header_file_name = FString::Printf(TEXT("SkUE%s.generated.hpp"), *skookum_struct_name);
+  m_all_header_file_names.Add(struct_header_file_name);
 
-    function_body += TEXT(")") + return_type_name + TEXT("\n");
+  FString header_code;
+  header_code += TEXT("#pragma once\r\n\r\n");
+  header_code += TEXT("#include \"SkookumScript/SkClassBinding.hpp\"\r\n");
+  const FString struct_include_path = get_struct_include_path(struct_p);
+  if (struct_include_path.Len() > 0)
+    {
+    header_code += FString::Printf(TEXT("#include <%s>\r\n\r\n"), *struct_include_path);
+    }
+  else
+    {
+    header_code += FString::Printf(TEXT("// Note: Include path for %s was unknown at code generation time, so hopefully the struct is already known when compilation gets here\r\n\r\n"), *struct_name_cpp);
+    }
+  header_code += FString::Printf(TEXT("class SkUE%s : public SkClassBindingSimple%s<SkUE%s, %s>\r\n  {\r\n"),
+    *skookum_struct_name,
+    (struct_p->StructFlags & STRUCT_IsPlainOldData) ? TEXT("Zero") : TEXT(""),
+    *skookum_struct_name,
+    *struct_name_cpp);
+  header_code += TEXT("  public:\r\n");
+  header_code += TEXT("    static void register_bindings();\r\n");
+  header_code += TEXT("  };\r\n");
+  save_header_if_changed(m_binding_code_path / struct_header_file_name, header_code);
+
+  // Accessors for all blueprint visible fields
+  const FString struct_binding_file_name = FString::Printf(TEXT("SkUE%s.generated.inl"), *skookum_struct_name);
+  m_all_binding_file_names.Add(struct_binding_file_name);
+
+  TArray<MethodBinding> bindings;
+  MethodBinding binding;
+
+  FString generated_code;
+  generated_code += FString::Printf(TEXT("\r\nnamespace SkUE%s_Impl\r\n  {\r\n\r\n"), *skookum_struct_name);
+  generated_code += TEXT("  static UScriptStruct * ustruct_p = nullptr; // Set in register_bindings()\r\n\r\n");
+
+  for (TFieldIterator<UProperty> property_it(struct_p); property_it; ++property_it)
+    {
+    UProperty * property_p = *property_it;
+    if (!property_p->HasAnyPropertyFlags(CPF_BlueprintVisible) || property_p->ArrayDim > 1 || !is_property_type_supported(property_p))
+      {
+      continue;
+      }
+
+    const FString property_type_name = get_skookum_property_type_name(property_p);
+    const FString property_type_name_cpp = get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue);
+
+    binding.make_property_getter(property_p);
+    if (bindings.Find(binding) < 0)
+      {
+      FString body = TEXT("() ") + property_type_name + TEXT("\n");
+      FString path = struct_path / (binding.m_script_name.Replace(TEXT("?"), TEXT("-Q")) + TEXT("().sk"));
+      if (!save_script_file(body, path))
+        {
+        FError::Throwf(TEXT("Could not save file: %s"), *path);
+        }
+
+      FString default_ctor_argument = generate_property_default_ctor_argument(property_p);
+      if (!default_ctor_argument.IsEmpty())
+        {
+        default_ctor_argument = TEXT("(") + default_ctor_argument + TEXT(")");
+        }
+
+      generated_code += FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+      generated_code += FString::Printf(TEXT("    const %s & this_ref = scope_p->this_as<SkUE%s>();\r\n"), *struct_name_cpp, *skookum_struct_name);
+      generated_code += FString::Printf(TEXT("    static UProperty * property_p = FindField<UProperty>(ustruct_p, TEXT(\"%s\"));\r\n"), *property_p->GetName());
+      if (is_property_read_in_place(property_p))
+        {
+        generated_code += FString::Printf(TEXT("    const %s & property_value = *property_p->ContainerPtrToValuePtr<%s>(&this_ref);\r\n"), *property_type_name_cpp, *property_type_name_cpp);
+        }
+      else
+        {
+        generated_code += FString::Printf(TEXT("    %s property_value%s;\r\n"), *property_type_name_cpp, *default_ctor_argument);
+        generated_code += TEXT("    property_p->CopyCompleteValue(&property_value, property_p->ContainerPtrToValuePtr<void>(&this_ref));\r\n");
+        }
+      generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_return_value_passing(nullptr, nullptr, property_p, TEXT("property_value")));
+      generated_code += TEXT("    }\r\n\r\n");
+      bindings.Push(binding);
+      }
+
+    if (!property_p->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+      {
+      binding.make_property_setter(property_p);
+      if (bindings.Find(binding) < 0)
+        {
+        FString body = TEXT("(") + property_type_name + TEXT(" ") + skookify_var_name(property_p->GetName()) + TEXT(")\n");
+        FString path = struct_path / (binding.m_script_name + TEXT("().sk"));
+        if (!save_script_file(body, path))
+          {
+          FError::Throwf(TEXT("Could not save file: %s"), *path);
+          }
+
+        generated_code += FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+        generated_code += FString::Printf(TEXT("    %s & this_ref = scope_p->this_as<SkUE%s>();\r\n"), *struct_name_cpp, *skookum_struct_name);
+        generated_code += FString::Printf(TEXT("    static UProperty * property_p = FindField<UProperty>(ustruct_p, TEXT(\"%s\"));\r\n"), *property_p->GetName());
+        generated_code += FString::Printf(TEXT("    %s property_value = %s;\r\n"), *property_type_name_cpp, *generate_method_parameter_expression(NULL, property_p, 0));
+        generated_code += TEXT("    property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(&this_ref), &property_value);\r\n");
+        generated_code += TEXT("    }\r\n\r\n");
+        bindings.Push(binding);
+        }
+      }
+    }
+
+  if (bindings.Num() > 0)
+    {
+    generated_code += TEXT("  static const SkClass::MethodInitializerFuncId methods_i[] =\r\n    {\r\n");
+    for (auto & method_binding : bindings)
+      {
+      generated_code += FString::Printf(TEXT("      { 0x%08x, mthd_%s },\r\n"), get_skookum_string_crc(*method_binding.m_script_name), *method_binding.m_code_name);
+      }
+    generated_code += TEXT("    };\r\n\r\n");
+    }
+
+  generated_code += FString::Printf(TEXT("  } // SkUE%s_Impl\r\n\r\n"), *skookum_struct_name);
+
+  // Register bindings function
+  generated_code += FString::Printf(TEXT("void SkUE%s::register_bindings()\r\n  {\r\n"), *skookum_struct_name);
+  generated_code += FString::Printf(TEXT("  tBindingBase::register_bindings(0x%08x); // \"%s\"\r\n\r\n"), get_skookum_string_crc(*skookum_struct_name), *skookum_struct_name);
+  generated_code += FString::Printf(TEXT("  SkUE%s_Impl::ustruct_p = FindObjectChecked<UScriptStruct>(nullptr, TEXT(\"%s\"));\r\n"), *skookum_struct_name, *struct_p->GetPathName());
+  if (bindings.Num() > 0)
+    {
+    generated_code += FString::Printf(TEXT("  ms_class_p->register_method_func_bulk(SkUE%s_Impl::methods_i, %d, SkBindFlag_instance_no_rebind);\r\n"), *skookum_struct_name, bindings.Num());
+    }
+  generated_code += TEXT("  }\r\n");
+
+  save_header_if_changed(m_binding_code_path / struct_binding_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_method(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding)
+  {
+  // Generate script file
+  generate_method_script_file(function_p, binding.m_script_name);
+
+  // Generate binding code
+  return generate_method_binding_code(class_name_cpp, class_p, function_p, binding);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_method_script_file(UFunction * function_p, const FString & script_function_name)
+  {
+  // Generate function content
+  FString function_body;
+  function_body.Reserve(1024);
+  bool has_params_or_return_value = (function_p->Children != NULL);
+  if (has_params_or_return_value)
+    {
+    function_body += TEXT("(");
+
+    FString separator;
+    FString return_type_name;
+    FString return_params;
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      UProperty * param_p = *param_it;
+      if (param_p->GetPropertyFlags() & CPF_ReturnParm)
+        {
+        return_type_name = TEXT(" ") + get_skookum_property_type_name(param_p);
+        }
+      else if (is_return_arg_param(param_p))
+        {
+        return_params += (return_params.IsEmpty() ? TEXT("; ") : TEXT(", ")) + get_skookum_property_type_name(param_p) + TEXT(" ") + skookify_var_name(param_p->GetName());
+        }
+      else
+        {
+        function_body += separator + get_skookum_property_type_name(param_p) + TEXT(" ") + skookify_var_name(param_p->GetName());
+        separator = TEXT(", ");
+        }
+      }
+
+    function_body += return_params + TEXT(")") + return_type_name + TEXT("\n");
     }
   else
     {
@@ -602,7 +1460,7 @@ void FSkookumScriptGenerator::generate_method_script_file(UFunction * function_p
 
   // Create script file
   FString function_file_path = get_skookum_method_path(function_p->GetOwnerClass(), script_function_name, function_p->HasAnyFunctionFlags(FUNC_Static));
-  if (!FFileHelper::SaveStringToFile(function_body, *function_file_path))
+  if (!save_script_file(function_body, function_file_path))
     {
     FError::Throwf(TEXT("Could not save file: %s"), *function_file_path);
     }
@@ -617,9 +1475,32 @@ FString FSkookumScriptGenerator::generate_method_binding_code(const FString & cl
   bool is_static = function_p->HasAnyFunctionFlags(FUNC_Static);
 
   FString function_body;
+  function_body += generate_binding_instrumentation(class_p, binding);
   function_body += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, is_static));
 
+  // Results of memoized functions are kept per object until the frame counter moves on - repeat calls skip ProcessEvent
+  const bool is_memoized = is_memoized_function(function_p);
+  FString memo_store;
+  if (is_memoized)
+    {
+    UProperty * memo_return_value_p = function_p->GetReturnProperty();
+    FString memo_type_name = get_cpp_property_type_name(memo_return_value_p, CPPF_ArgumentOrReturnValue);
+    function_body += TEXT("    static uint64 memo_frame = 0; // Frame the results below belong to\r\n");
+    function_body += FString::Printf(TEXT("    static TMap<const UObject *, %s> memo_results;\r\n"), *memo_type_name);
+    function_body += TEXT("    if (memo_frame != GFrameCounter)\r\n      {\r\n");
+    function_body += TEXT("      memo_results.Reset();\r\n");
+    function_body += TEXT("      memo_frame = GFrameCounter;\r\n");
+    function_body += TEXT("      }\r\n");
+    function_body += FString::Printf(TEXT("    const %s * memo_result_p = memo_results.Find(this_p);\r\n"), *memo_type_name);
+    function_body += TEXT("    if (memo_result_p)\r\n      {\r\n");
+    function_body += FString::Printf(TEXT("      %s\r\n"), *generate_return_value_passing(class_p, function_p, memo_return_value_p, TEXT("*memo_result_p")));
+    function_body += TEXT("      return;\r\n");
+    function_body += TEXT("      }\r\n");
+    memo_store = FString::Printf(TEXT("      memo_results.Add(this_p, params.%s);\r\n"), *memo_return_value_p->GetName());
+    }
+
   FString params;
+  FString out_params;
 
   const bool bHasParamsOrReturnValue = (function_p->Children != NULL);
   if (bHasParamsOrReturnValue)
@@ -633,21 +1514,37 @@ FString FSkookumScriptGenerator::generate_method_binding_code(const FString & cl
       }
     params += TEXT("      } params;\r\n");
     int32 ParamIndex = 0;
-    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it, ++ParamIndex)
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
       {
       UProperty * param_p = *param_it;
       params += FString::Printf(TEXT("    params.%s = %s;\r\n"), *param_p->GetName(), *generate_method_parameter_expression(function_p, param_p, ParamIndex));
+      if (!(param_p->GetPropertyFlags() & CPF_ReturnParm) && !is_return_arg_param(param_p))
+        {
+        ++ParamIndex;
+        }
+      }
+
+    // Out parameters get passed back as return arguments - they follow the regular arguments
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      UProperty * param_p = *param_it;
+      if (is_return_arg_param(param_p))
+        {
+        out_params += FString::Printf(TEXT("      scope_p->set_arg(SkArg_%d, SkMarshal<%s>::to_result(params.%s));\r\n"), ++ParamIndex, *get_skookum_binding_class_name(param_p), *param_p->GetName());
+        }
       }
     }
 
-  params += FString::Printf(TEXT("    SK_ASSERTX(this_p, \"Tried to invoke method %s@%s but the %s is null.\");\r\n"), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p));
-  params += TEXT("    if (this_p)\r\n      {\r\n");
-  params += FString::Printf(TEXT("      static UFunction * function_p = this_p->FindFunctionChecked(TEXT(\"%s\"));\r\n"), *function_p->GetName());
+  params += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but the %s is null."), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p))));
+  params += FString::Printf(TEXT("    if (%s)\r\n      {\r\n"), *generate_this_pointer_test());
+  params += FString::Printf(TEXT("      %s\r\n"), *generate_function_lookup(function_p, is_thread_safe_function(function_p)));
 
   if (bHasParamsOrReturnValue)
     {
     params += TEXT("      check(function_p->ParmsSize <= sizeof(FDispatchParams));\r\n");
     params += TEXT("      this_p->ProcessEvent(function_p, &params);\r\n");
+    params += out_params;
+    params += memo_store;
     }
   else
     {
@@ -682,6 +1579,73 @@ FString FSkookumScriptGenerator::generate_method_binding_code(const FString & cl
 
 //---------------------------------------------------------------------------------------
 
+void FSkookumScriptGenerator::generate_method_descriptor(UClass * class_p, UFunction * function_p, const MethodBinding & binding, FString * declarations_p, FString * rows_p)
+  {
+  const FString struct_name = TEXT("FParams_") + binding.m_code_name;
+  const bool has_params_or_return_value = (function_p->Children != NULL);
+
+  // Parameter struct is only declared for its layout - offsets and size get baked into the descriptor
+  if (has_params_or_return_value)
+    {
+    *declarations_p += FString::Printf(TEXT("  struct %s\r\n    {\r\n"), *struct_name);
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      UProperty * param_p = *param_it;
+      *declarations_p += FString::Printf(TEXT("    %s %s;\r\n"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *param_p->GetName());
+      }
+    *declarations_p += TEXT("    };\r\n\r\n");
+    }
+
+  // Build argument and return value descriptors
+  FString param_rows;
+  int32 param_count = 0;
+  FString return_descriptor = TEXT("{ SkUEParamType_nil, 0 }");
+  FString wrap_object_func = TEXT("nullptr");
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    eSkTypeID type_id = get_skookum_property_type(param_p);
+    FString descriptor = FString::Printf(TEXT("{ SkUEParamType_%s, STRUCT_OFFSET(%s, %s) }"), *ms_sk_type_id_names[type_id], *struct_name, *param_p->GetName());
+    if (param_p->GetPropertyFlags() & CPF_ReturnParm)
+      {
+      return_descriptor = descriptor;
+      if (type_id == SkTypeID_UObject)
+        {
+        UClass * return_class_p = CastChecked<UObjectPropertyBase>(param_p)->PropertyClass;
+        wrap_object_func = FString::Printf(TEXT("&SkUEDescriptorThunk::wrap_object<SkUE%s, %s>"), *get_skookum_property_type_name(param_p), *get_cpp_class_name(return_class_p));
+        }
+      }
+    else
+      {
+      param_rows += FString::Printf(TEXT("    %s,\r\n"), *descriptor);
+      ++param_count;
+      }
+    }
+
+  FString params_array_name = TEXT("nullptr");
+  if (param_count > 0)
+    {
+    params_array_name = TEXT("desc_params_") + binding.m_code_name;
+    *declarations_p += FString::Printf(TEXT("  static const SkUEParamDescriptor %s[] =\r\n    {\r\n%s    };\r\n\r\n"), *params_array_name, *param_rows);
+    }
+
+  const bool is_static = function_p->HasAnyFunctionFlags(FUNC_Static);
+  *rows_p += FString::Printf(TEXT("      { TEXT(\"%s\"), %s, %s, &function_cache[%d], %s, %d, %s, %s, %s, %s }, // %s\r\n"),
+    *function_p->GetName(),
+    is_static ? TEXT("&default_object_p") : TEXT("nullptr"),
+    is_static ? TEXT("nullptr") : *FString::Printf(TEXT("&SkUEDescriptorThunk::get_this<SkUE%s>"), *get_skookum_class_name(class_p)),
+    binding.m_descriptor_index,
+    *params_array_name,
+    param_count,
+    has_params_or_return_value ? *FString::Printf(TEXT("sizeof(%s)"), *struct_name) : TEXT("0"),
+    *return_descriptor,
+    *wrap_object_func,
+    is_static ? TEXT("true") : TEXT("false"),
+    *binding.m_script_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
 FString FSkookumScriptGenerator::generate_property_getter(const FString & class_name_cpp, UClass * class_p, UProperty * property_p, int32 property_index, const MethodBinding & binding)
   {
   // Generate script file
@@ -697,7 +1661,7 @@ void FSkookumScriptGenerator::generate_property_getter_script_file(UProperty * p
   {
   FString body = TEXT("() ") + get_skookum_property_type_name(property_p) + TEXT("\n");
   FString function_file_path = get_skookum_method_path(property_p->GetOwnerClass(), script_function_name, false);
-  if (!FFileHelper::SaveStringToFile(body, *function_file_path))
+  if (!save_script_file(body, function_file_path))
     {
     FError::Throwf(TEXT("Could not save file: %s"), *function_file_path);
     }
@@ -716,13 +1680,26 @@ FString FSkookumScriptGenerator::generate_property_getter_binding_code(UProperty
     }
 
   generated_code += FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+  generated_code += generate_binding_instrumentation(class_p, binding);
   generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, false));
-  generated_code += FString::Printf(TEXT("    static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUE%s::ms_uclass_p, TEXT(\"%s\"));\r\n"), *get_skookum_class_name(class_p), *property_p->GetName());
-  generated_code += FString::Printf(TEXT("    %s property_value%s;\r\n"), *get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue), *default_ctor_argument);
-  generated_code += FString::Printf(TEXT("    SK_ASSERTX(this_p, \"Tried to invoke method %s@%s but the %s is null.\");\r\n"), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p));
-  generated_code += TEXT("    if (this_p)\r\n      {\r\n");
-  generated_code += TEXT("      property_p->CopyCompleteValue(&property_value, property_p->ContainerPtrToValuePtr<void>(this_p));\r\n");
-  generated_code += TEXT("      }\r\n");
+  generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_property_lookup(class_p, property_p));
+  const FString this_pointer_assert = generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but the %s is null."), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p)));
+  if (is_property_read_in_place(property_p))
+    {
+    // Arrays and structs are read in place rather than copied first - the only copy made is the one into the result instance
+    FString property_type_name_cpp = get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue);
+    generated_code += FString::Printf(TEXT("    %s\r\n"), *this_pointer_assert);
+    generated_code += FString::Printf(TEXT("    static const %s empty_value%s;\r\n"), *property_type_name_cpp, *default_ctor_argument);
+    generated_code += FString::Printf(TEXT("    const %s & property_value = %s ? *property_p->ContainerPtrToValuePtr<%s>(this_p) : empty_value;\r\n"), *property_type_name_cpp, *generate_this_pointer_test(), *property_type_name_cpp);
+    }
+  else
+    {
+    generated_code += FString::Printf(TEXT("    %s property_value%s;\r\n"), *get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue), *default_ctor_argument);
+    generated_code += FString::Printf(TEXT("    %s\r\n"), *this_pointer_assert);
+    generated_code += FString::Printf(TEXT("    if (%s)\r\n      {\r\n"), *generate_this_pointer_test());
+    generated_code += TEXT("      property_p->CopyCompleteValue(&property_value, property_p->ContainerPtrToValuePtr<void>(this_p));\r\n");
+    generated_code += TEXT("      }\r\n");
+    }
   generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_return_value_passing(class_p, NULL, property_p, TEXT("property_value")));
   generated_code += TEXT("    }\r\n\r\n");
 
@@ -749,7 +1726,7 @@ void FSkookumScriptGenerator::generate_property_setter_script_file(UProperty * p
   FString class_path = get_skookum_class_path(property_p->GetOwnerClass());
   FString body = TEXT("(") + get_skookum_property_type_name(property_p) + TEXT(" ") + var_name + TEXT(")\n");
   FString path = class_path / file_name;
-  if (!FFileHelper::SaveStringToFile(body, *path))
+  if (!save_script_file(body, path))
     {
     FError::Throwf(TEXT("Could not save file: %s"), *path);
     }
@@ -762,12 +1739,21 @@ FString FSkookumScriptGenerator::generate_property_setter_binding_code(UProperty
   FString generated_code;
 
   generated_code += FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+  generated_code += generate_binding_instrumentation(class_p, binding);
   generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, false));
-  generated_code += FString::Printf(TEXT("    SK_ASSERTX(this_p, \"Tried to invoke method %s@%s but the %s is null.\");\r\n"), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p));
-  generated_code += TEXT("    if (this_p)\r\n      {\r\n");
-  generated_code += FString::Printf(TEXT("      static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUE%s::ms_uclass_p, TEXT(\"%s\"));\r\n"), *get_skookum_class_name(class_p), *property_p->GetName());
+  generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but the %s is null."), *get_skookum_class_name(class_p), *binding.m_script_name, *get_skookum_class_name(class_p))));
+  generated_code += FString::Printf(TEXT("    if (%s)\r\n      {\r\n"), *generate_this_pointer_test());
+  generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_property_lookup(class_p, property_p));
   generated_code += FString::Printf(TEXT("      %s property_value = %s;\r\n"), *get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue), *generate_method_parameter_expression(NULL, property_p, 0));
-  generated_code += TEXT("      property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &property_value);\r\n");
+  if (get_skookum_property_type(property_p) == SkTypeID_List)
+    {
+    // Hand the freshly built array buffer over instead of copying it
+    generated_code += FString::Printf(TEXT("      *property_p->ContainerPtrToValuePtr<%s>(this_p) = MoveTemp(property_value);\r\n"), *get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue));
+    }
+  else
+    {
+    generated_code += TEXT("      property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &property_value);\r\n");
+    }
   generated_code += TEXT("      }\r\n");
   generated_code += TEXT("    }\r\n\r\n");
 
@@ -776,520 +1762,3061 @@ FString FSkookumScriptGenerator::generate_property_setter_binding_code(UProperty
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::generate_method_binding_declaration(const FString & function_name, bool is_static)
+FString FSkookumScriptGenerator::generate_batch_method(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding)
   {
-  return FString::Printf(TEXT("static void mthd%s_%s(SkInvokedMethod * scope_p, SkInstance ** result_pp)"), is_static ? TEXT("c") : TEXT(""), *function_name);
-  }
+  const FString skookum_class_name = get_skookum_class_name(class_p);
 
-//---------------------------------------------------------------------------------------
+  // Generate script file
+  FString script_params = FString::Printf(TEXT("List{%s} receivers"), *skookum_class_name);
+  FString return_type_name;
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (param_p->GetPropertyFlags() & CPF_ReturnParm)
+      {
+      return_type_name = FString::Printf(TEXT("List{%s}"), *get_skookum_property_type_name(param_p));
+      }
+    else
+      {
+      script_params += FString::Printf(TEXT(", List{%s} %s"), *get_skookum_property_type_name(param_p), *skookify_var_name(param_p->GetName()));
+      }
+    }
+  generate_batch_script_file(class_p, binding.m_script_name, script_params, return_type_name);
 
-FString FSkookumScriptGenerator::generate_this_pointer_initialization(const FString & class_name_cpp, UClass * class_p, bool is_static)
-  {
-  FString class_name_skookum = get_skookum_class_name(class_p);
-  if (is_static)
+  // Generate binding code
+  FString generated_code = FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, true));
+  generated_code += generate_binding_instrumentation(class_p, binding);
+  generated_code += TEXT("    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();\r\n");
+  generated_code += TEXT("    const uint32 count = receivers.get_length();\r\n");
+
+  // Unpack each argument list into a contiguous array up front
+  UProperty * return_value_p = NULL;
+  int32 arg_index = 2;
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
     {
-    return FString::Printf(TEXT("%s * this_p = GetMutableDefault<%s>(SkUE%s::ms_uclass_p);"), *class_name_cpp, *class_name_cpp, *class_name_skookum);
+    UProperty * param_p = *param_it;
+    if (param_p->GetPropertyFlags() & CPF_ReturnParm)
+      {
+      return_value_p = param_p;
+      }
+    else
+      {
+      generated_code += FString::Printf(TEXT("    %s args_%s;\r\n"), *get_batch_array_type_name(param_p), *param_p->GetName());
+      generated_code += FString::Printf(TEXT("    SkUEBatch::unpack<%s>(scope_p, SkArg_%d, count, &args_%s);\r\n"), *get_skookum_binding_class_name(param_p), arg_index++, *param_p->GetName());
+      }
     }
-  else
+  if (return_value_p)
     {
-    return FString::Printf(TEXT("%s * this_p = scope_p->this_as<SkUE%s>();"), *class_name_cpp, *class_name_skookum);
+    generated_code += FString::Printf(TEXT("    %s results;\r\n"), *get_batch_array_type_name(return_value_p));
+    generated_code += TEXT("    results.Reserve(count);\r\n");
     }
-  }
-
-//---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::generate_method_parameter_expression(UFunction * function_p, UProperty * param_p, int32 ParamIndex)
-  {
-  if (!(param_p->GetPropertyFlags() & CPF_ReturnParm))
+  const bool has_params_or_return_value = (function_p->Children != NULL);
+  if (has_params_or_return_value)
     {
-    FString Initializer;
-
-    eSkTypeID type_id = get_skookum_property_type(param_p);
-    switch (type_id)
-      {
-      case SkTypeID_Integer:         Initializer = TEXT("int(scope_p->get_arg<SkInteger>(SkArg_%d))"); break;
-      case SkTypeID_Real:            Initializer = TEXT("float(scope_p->get_arg<SkReal>(SkArg_%d))"); break;
-      case SkTypeID_Boolean:         Initializer = TEXT("scope_p->get_arg<SkBoolean>(SkArg_%d)"); break;
-      case SkTypeID_String:          Initializer = TEXT("FString(scope_p->get_arg<SkString>(SkArg_%d).as_cstr())"); break; // $revisit MBreyer - Avoid copy here
-      case SkTypeID_Name:            Initializer = TEXT("scope_p->get_arg<SkUEName>(SkArg_%d)"); break;
-      case SkTypeID_Vector2:         Initializer = TEXT("scope_p->get_arg<SkVector2>(SkArg_%d)"); break;
-      case SkTypeID_Vector3:         Initializer = TEXT("scope_p->get_arg<SkVector3>(SkArg_%d)"); break;
-      case SkTypeID_Vector4:         Initializer = TEXT("scope_p->get_arg<SkVector4>(SkArg_%d)"); break;
-      case SkTypeID_Rotation:        Initializer = TEXT("scope_p->get_arg<SkRotation>(SkArg_%d)"); break;
-      case SkTypeID_RotationAngles:  Initializer = TEXT("scope_p->get_arg<SkRotationAngles>(SkArg_%d)"); break;
-      case SkTypeID_Transform:       Initializer = TEXT("scope_p->get_arg<SkTransform>(SkArg_%d)"); break;
-      case SkTypeID_Color:           Initializer = TEXT("scope_p->get_arg<SkColor>(SkArg_%d)"); break;
-      case SkTypeID_UClass:          Initializer = TEXT("scope_p->get_arg<SkUEEntityClass>(SkArg_%d)"); break;
-      case SkTypeID_UObject:         Initializer = FString::Printf(TEXT("scope_p->get_arg<SkUE%s>(SkArg_%%d)"), *get_skookum_property_type_name(param_p)); break;
-      default:                       FError::Throwf(TEXT("Unsupported function param type: %s"), *param_p->GetClass()->GetName()); break;
-      }
-
-    return FString::Printf(*Initializer, ParamIndex + 1);
+    generated_code += TEXT("    struct FDispatchParams\r\n      {\r\n");
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      UProperty * param_p = *param_it;
+      generated_code += FString::Printf(TEXT("      %s %s;\r\n"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *param_p->GetName());
+      }
+    generated_code += TEXT("      } params;\r\n");
     }
-  else if (param_p->IsA(UObjectPropertyBase::StaticClass()) || param_p->IsA(UClassProperty::StaticClass()))
+  if (m_generate_shipping_profile)
     {
-    return TEXT("nullptr");
+    generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_function_lookup(function_p, false));
     }
   else
     {
-    return FString::Printf(TEXT("%s(%s)"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *generate_property_default_ctor_argument(param_p));
+    generated_code += FString::Printf(TEXT("    static UFunction * function_p = SkUE%s::ms_uclass_p->GetDefaultObject()->FindFunctionChecked(FName(TEXT(\"%s\")));\r\n"), *skookum_class_name, *function_p->GetName());
+    }
+  if (has_params_or_return_value)
+    {
+    generated_code += TEXT("    check(function_p->ParmsSize <= sizeof(FDispatchParams));\r\n");
     }
-  }
 
-//---------------------------------------------------------------------------------------
+  // Invoke once per receiver
+  generated_code += TEXT("    for (uint32 i = 0; i < count; ++i)\r\n      {\r\n");
+  generated_code += FString::Printf(TEXT("      %s * this_p = SkMarshal<SkUE%s>::from_instance(receivers.get_array()[i]);\r\n"), *class_name_cpp, *skookum_class_name);
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (param_p->GetPropertyFlags() & CPF_ReturnParm)
+      {
+      generated_code += FString::Printf(TEXT("      params.%s = %s;\r\n"), *param_p->GetName(), *generate_method_parameter_expression(function_p, param_p, 0));
+      }
+    else
+      {
+      generated_code += FString::Printf(TEXT("      params.%s = args_%s[i];\r\n"), *param_p->GetName(), *param_p->GetName());
+      }
+    }
+  generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but one of the receivers is null."), *skookum_class_name, *binding.m_script_name)));
+  generated_code += FString::Printf(TEXT("      if (%s)\r\n        {\r\n"), *generate_this_pointer_test());
+  generated_code += FString::Printf(TEXT("        this_p->ProcessEvent(function_p, %s);\r\n"), has_params_or_return_value ? TEXT("&params") : TEXT("nullptr"));
+  if (return_value_p)
+    {
+    generated_code += FString::Printf(TEXT("        results.Add(params.%s);\r\n"), *return_value_p->GetName());
+    }
+  generated_code += TEXT("        }\r\n");
+  if (return_value_p)
+    {
+    // Keep results lined up with the receivers - a null receiver gets the empty value of the result type
+    generated_code += TEXT("      else\r\n        {\r\n");
+    generated_code += FString::Printf(TEXT("        results.Add(%s);\r\n"), *generate_method_parameter_expression(function_p, return_value_p, 0));
+    generated_code += TEXT("        }\r\n");
+    }
+  generated_code += TEXT("      }\r\n");
 
-FString FSkookumScriptGenerator::generate_property_default_ctor_argument(UProperty * param_p)
-  {
-  eSkTypeID type_id = get_skookum_property_type(param_p);
-  switch (type_id)
+  if (return_value_p)
     {
-    case SkTypeID_Integer:         return TEXT("0");
-    case SkTypeID_Real:            return TEXT("0.0f");
-    case SkTypeID_Boolean:         return TEXT("false");
-    case SkTypeID_String:          
-    case SkTypeID_Name:            
-    case SkTypeID_Transform:       return TEXT("");
-    case SkTypeID_Vector2:         
-    case SkTypeID_Vector3:         
-    case SkTypeID_Vector4:         
-    case SkTypeID_Rotation:        
-    case SkTypeID_RotationAngles:  
-    case SkTypeID_Color:           return TEXT("ForceInitToZero");
-    case SkTypeID_UClass:          
-    case SkTypeID_UObject:         return TEXT("nullptr");
-    default:                       FError::Throwf(TEXT("Unsupported property type: %s"), *param_p->GetClass()->GetName()); return TEXT("");
+    generated_code += FString::Printf(TEXT("    if (result_pp) *result_pp = SkUEBatch::pack<%s>(results);\r\n"), *get_skookum_binding_class_name(return_value_p));
     }
+  generated_code += TEXT("    }\r\n\r\n");
+
+  return generated_code;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::generate_return_value_passing(UClass * class_p, UFunction * function_p, UProperty * return_value_p, const FString & return_value_name)
+FString FSkookumScriptGenerator::generate_batch_property_accessor(const FString & class_name_cpp, UClass * class_p, UProperty * property_p, bool is_setter, const MethodBinding & binding)
   {
-  if (return_value_p)
+  const FString skookum_class_name = get_skookum_class_name(class_p);
+  const FString property_type_name = get_skookum_property_type_name(property_p);
+  const FString property_type_name_cpp = get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue);
+  const FString binding_class_name = get_skookum_binding_class_name(property_p);
+
+  // Generate script file
+  FString script_params = FString::Printf(TEXT("List{%s} receivers"), *skookum_class_name);
+  if (is_setter)
     {
-    FString fmt;
+    script_params += FString::Printf(TEXT(", List{%s} %s"), *property_type_name, *skookify_var_name(property_p->GetName()));
+    }
+  generate_batch_script_file(class_p, binding.m_script_name, script_params, is_setter ? FString() : FString::Printf(TEXT("List{%s}"), *property_type_name));
 
-    eSkTypeID type_id = get_skookum_property_type(return_value_p);
-    switch (type_id)
+  // Generate binding code
+  FString generated_code = FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, true));
+  generated_code += generate_binding_instrumentation(class_p, binding);
+  generated_code += TEXT("    const APArray<SkInstance> & receivers = scope_p->get_arg<SkList>(SkArg_1).get_instances();\r\n");
+  generated_code += TEXT("    const uint32 count = receivers.get_length();\r\n");
+  generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_property_lookup(class_p, property_p));
+  if (is_setter)
+    {
+    generated_code += FString::Printf(TEXT("    %s values;\r\n"), *get_batch_array_type_name(property_p));
+    generated_code += FString::Printf(TEXT("    SkUEBatch::unpack<%s>(scope_p, SkArg_2, count, &values);\r\n"), *binding_class_name);
+    }
+  else
+    {
+    FString default_ctor_argument = generate_property_default_ctor_argument(property_p);
+    if (!default_ctor_argument.IsEmpty())
       {
-      case SkTypeID_Integer:         fmt = TEXT("SkInteger::new_instance(%s)"); break;
-      case SkTypeID_Real:            fmt = TEXT("SkReal::new_instance(%s)"); break;
-      case SkTypeID_Boolean:         fmt = TEXT("SkBoolean::new_instance(%s)"); break;
-      case SkTypeID_String:          fmt = TEXT("SkString::new_instance(AString(*%s, %s.Len()))"); break; // $revisit MBreyer - Avoid copy here
-      case SkTypeID_Name:            fmt = TEXT("SkUEName::new_instance(%s)"); break;
-      case SkTypeID_Vector2:         fmt = TEXT("SkVector2::new_instance(%s)"); break;
-      case SkTypeID_Vector3:         fmt = TEXT("SkVector3::new_instance(%s)"); break;
-      case SkTypeID_Vector4:         fmt = TEXT("SkVector4::new_instance(%s)"); break;
-      case SkTypeID_Rotation:        fmt = TEXT("SkRotation::new_instance(%s)"); break;
-      case SkTypeID_RotationAngles:  fmt = TEXT("SkRotationAngles::new_instance(%s)"); break;
-      case SkTypeID_Transform:       fmt = TEXT("SkTransform::new_instance(%s)"); break;
-      case SkTypeID_Color:           fmt = TEXT("SkColor::new_instance(%s)"); break;
-      case SkTypeID_UClass:          fmt = TEXT("SkUEEntityClass::new_instance(%s)"); break;
-      case SkTypeID_UObject:         fmt = FString::Printf(TEXT("SkUE%s::new_instance(%%s)"), *get_skookum_property_type_name(return_value_p)); break;
-      default:                       FError::Throwf(TEXT("Unsupported return param type: %s"), *return_value_p->GetClass()->GetName()); break;
+      default_ctor_argument = TEXT("(") + default_ctor_argument + TEXT(")");
       }
+    generated_code += FString::Printf(TEXT("    %s results;\r\n"), *get_batch_array_type_name(property_p));
+    generated_code += TEXT("    results.Reserve(count);\r\n");
+    generated_code += FString::Printf(TEXT("    const %s default_value%s;\r\n"), *property_type_name_cpp, *default_ctor_argument);
+    }
 
-    FString initializer = FString::Printf(*fmt, *return_value_name, *return_value_name);
-    return FString::Printf(TEXT("if (result_pp) *result_pp = %s;"), *initializer);
+  generated_code += TEXT("    for (uint32 i = 0; i < count; ++i)\r\n      {\r\n");
+  generated_code += FString::Printf(TEXT("      %s * this_p = SkMarshal<SkUE%s>::from_instance(receivers.get_array()[i]);\r\n"), *class_name_cpp, *skookum_class_name);
+  generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but one of the receivers is null."), *skookum_class_name, *binding.m_script_name)));
+  if (is_setter)
+    {
+    generated_code += FString::Printf(TEXT("      if (%s)\r\n        {\r\n"), *generate_this_pointer_test());
+    generated_code += TEXT("        property_p->CopyCompleteValue(property_p->ContainerPtrToValuePtr<void>(this_p), &values[i]);\r\n");
+    generated_code += TEXT("        }\r\n");
     }
   else
     {
-    return TEXT(""); // TEXT("if (result_pp) *result_pp = SkBrain::ms_nil_p;");
+    generated_code += TEXT("      int32 result_index = results.Add(default_value);\r\n");
+    generated_code += FString::Printf(TEXT("      if (%s)\r\n        {\r\n"), *generate_this_pointer_test());
+    generated_code += TEXT("        property_p->CopyCompleteValue(&results[result_index], property_p->ContainerPtrToValuePtr<void>(this_p));\r\n");
+    generated_code += TEXT("        }\r\n");
     }
-  }
+  generated_code += TEXT("      }\r\n");
+
+  if (!is_setter)
+    {
+    generated_code += FString::Printf(TEXT("    if (result_pp) *result_pp = SkUEBatch::pack<%s>(results);\r\n"), *binding_class_name);
+    }
+  generated_code += TEXT("    }\r\n\r\n");
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_batch_array_type_name(UProperty * property_p) const
+  {
+  // Vectors, quaternions and transforms are laid out on 16 byte boundaries so the native loop can use aligned SIMD loads
+  const FString type_name_cpp = get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue);
+  switch (get_skookum_property_type(property_p))
+    {
+    case SkTypeID_Vector3:
+    case SkTypeID_Rotation:
+    case SkTypeID_Transform:
+      return FString::Printf(TEXT("SkUEBatch::tAlignedArray<%s>"), *type_name_cpp);
+    default:
+      return FString::Printf(TEXT("TArray<%s>"), *type_name_cpp);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_batch_script_file(UClass * class_p, const FString & script_function_name, const FString & params, const FString & return_type_name)
+  {
+  FString body = TEXT("(") + params + TEXT(")");
+  if (!return_type_name.IsEmpty())
+    {
+    body += TEXT(" ") + return_type_name;
+    }
+  body += TEXT("\n");
+
+  FString function_file_path = get_skookum_method_path(class_p, script_function_name, true);
+  if (!save_script_file(body, function_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *function_file_path);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_coroutine(const FString & class_name_cpp, UClass * class_p, UFunction * function_p, const MethodBinding & binding)
+  {
+  const FString skookum_class_name = get_skookum_class_name(class_p);
+  const bool is_static = function_p->HasAnyFunctionFlags(FUNC_Static);
+  UProperty * latent_info_param_p = get_latent_info_param(function_p);
+
+  // Static latent functions run on the Entity the coroutine is invoked on which also serves as their world context
+  const FString world_context_param_name = is_static ? function_p->GetMetaData(TEXT("WorldContext")) : FString();
+
+  // Generate script file
+  FString script_params;
+  FString separator;
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (param_p != latent_info_param_p && param_p->GetName() != world_context_param_name)
+      {
+      script_params += separator + get_skookum_property_type_name(param_p) + TEXT(" ") + skookify_var_name(param_p->GetName());
+      separator = TEXT(", ");
+      }
+    }
+  FString coroutine_file_path = get_skookum_class_path(is_static ? UObject::StaticClass() : class_p) / (binding.m_script_name + TEXT("().sk"));
+  if (!save_script_file(TEXT("(") + script_params + TEXT(")\n"), coroutine_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *coroutine_file_path);
+    }
+
+  // Generate binding code - first update starts the latent action and suspends until SkUELatentCallback resumes us
+  FString generated_code = FString::Printf(TEXT("  static bool coro_%s(SkInvokedCoroutine * scope_p)\r\n    {\r\n"), *binding.m_code_name);
+  generated_code += TEXT("    if (scope_p->m_update_count == 0u)\r\n      {\r\n");
+  // Only the update starting the latent action is measured, the wait until it completes is not binding overhead
+  FString instrumentation = generate_binding_instrumentation(class_p, binding);
+  if (!instrumentation.IsEmpty())
+    {
+    // Static coroutines end up in the Entity binding file, outside the namespace holding the counters
+    generated_code += TEXT("  ") + instrumentation.Replace(TEXT("binding_stats["), *FString::Printf(TEXT("SkUE%s_Impl::binding_stats["), *skookum_class_name));
+    }
+  if (is_static)
+    {
+    generated_code += FString::Printf(TEXT("      %s * this_p = static_cast<%s *>(SkUE%s_Impl::default_object_p);\r\n"), *class_name_cpp, *class_name_cpp, *skookum_class_name);
+    }
+  else
+    {
+    generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, false));
+    }
+  generated_code += TEXT("      struct FDispatchParams\r\n        {\r\n");
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    generated_code += FString::Printf(TEXT("        %s %s;\r\n"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *param_p->GetName());
+    }
+  generated_code += TEXT("        } params;\r\n");
+  int32 arg_index = 0;
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (param_p == latent_info_param_p)
+      {
+      generated_code += FString::Printf(TEXT("      params.%s = SkUELatentCallback::make_latent_info(scope_p);\r\n"), *param_p->GetName());
+      }
+    else if (param_p->GetName() == world_context_param_name)
+      {
+      generated_code += FString::Printf(TEXT("      params.%s = scope_p->this_as<SkUEEntity>();\r\n"), *param_p->GetName());
+      }
+    else
+      {
+      generated_code += FString::Printf(TEXT("      params.%s = %s;\r\n"), *param_p->GetName(), *generate_method_parameter_expression(function_p, param_p, arg_index++));
+      }
+    }
+  generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke coroutine %s@%s but the %s is null."), is_static ? TEXT("Entity") : *skookum_class_name, *binding.m_script_name, is_static ? TEXT("Entity") : *skookum_class_name)));
+  generated_code += FString::Printf(TEXT("      if (%s)\r\n        {\r\n"), *generate_this_pointer_test());
+  FString function_lookup = generate_function_lookup(function_p, false);
+  if (is_static)
+    {
+    function_lookup.ReplaceInline(TEXT("function_ptrs["), *FString::Printf(TEXT("SkUE%s_Impl::function_ptrs["), *skookum_class_name));
+    }
+  generated_code += FString::Printf(TEXT("        %s\r\n"), *function_lookup);
+  generated_code += TEXT("        check(function_p->ParmsSize <= sizeof(FDispatchParams));\r\n");
+  generated_code += TEXT("        this_p->ProcessEvent(function_p, &params);\r\n");
+  generated_code += TEXT("        scope_p->suspend(); // No updates until the latent action completes\r\n");
+  generated_code += TEXT("        return false;\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n");
+  generated_code += TEXT("    return true;\r\n");
+  generated_code += TEXT("    }\r\n\r\n");
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_entity_coroutine_file()
+  {
+  const FString coroutine_file_name = TEXT("SkUEEntityLatent.generated.inl");
+  m_all_binding_file_names.Add(coroutine_file_name);
+
+  FString generated_code;
+  generated_code += TEXT("\r\nnamespace SkUEEntityLatent_Impl\r\n  {\r\n\r\n");
+  generated_code += m_entity_coroutine_code;
+
+  generated_code += TEXT("  static const SkClass::CoroutineInitializerFuncId coroutines_i[] =\r\n    {\r\n");
+  for (auto & binding : m_entity_coroutine_bindings)
+    {
+    generated_code += FString::Printf(TEXT("      { 0x%08x, coro_%s },\r\n"), get_skookum_string_crc(*binding.m_script_name), *binding.m_code_name);
+    }
+  generated_code += TEXT("    };\r\n\r\n");
+
+  generated_code += TEXT("  void register_bindings()\r\n    {\r\n");
+  generated_code += FString::Printf(TEXT("    SkUEEntity::ms_class_p->register_coroutine_func_bulk(coroutines_i, %d, SkBindFlag_instance_no_rebind);\r\n"), m_entity_coroutine_bindings.Num());
+  generated_code += TEXT("    }\r\n\r\n");
+
+  generated_code += TEXT("  } // SkUEEntityLatent_Impl\r\n");
+
+  save_header_if_changed(m_binding_code_path / coroutine_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_property_snapshot(const FString & class_name_cpp, UClass * class_p, const TArray<UProperty *> & properties, bool is_apply, const MethodBinding & binding)
+  {
+  const FString skookum_class_name = get_skookum_class_name(class_p);
+
+  // Generate script file - the snapshot passes its values back via return arguments, apply takes them as regular arguments
+  FString params;
+  for (auto property_p : properties)
+    {
+    params += FString::Printf(TEXT("%s%s %s"), params.IsEmpty() ? TEXT("") : TEXT(", "), *get_skookum_property_type_name(property_p), *skookify_var_name(property_p->GetName()));
+    }
+  FString body = is_apply ? FString::Printf(TEXT("(%s)\n"), *params) : FString::Printf(TEXT("(; %s)\n"), *params);
+  FString function_file_path = get_skookum_method_path(class_p, binding.m_script_name, false);
+  if (!save_script_file(body, function_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *function_file_path);
+    }
+
+  // Generate binding code
+  FString generated_code = FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+  generated_code += generate_binding_instrumentation(class_p, binding);
+  generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, false));
+  generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but the %s is null."), *skookum_class_name, *binding.m_script_name, *skookum_class_name)));
+  generated_code += FString::Printf(TEXT("    if (%s)\r\n      {\r\n"), *generate_this_pointer_test());
+  generated_code += FString::Printf(TEXT("      %sUProperty * properties_p[%d] =\r\n        {\r\n"), m_generate_shipping_profile ? TEXT("") : TEXT("static "), properties.Num());
+  for (auto property_p : properties)
+    {
+    if (m_generate_shipping_profile)
+      {
+      generated_code += FString::Printf(TEXT("        property_ptrs[%d],\r\n"), m_property_lookup_names.AddUnique(property_p->GetName()));
+      }
+    else
+      {
+      generated_code += FString::Printf(TEXT("        SkUEClassBindingHelper::find_class_property(SkUE%s::ms_uclass_p, TEXT(\"%s\")),\r\n"), *skookum_class_name, *property_p->GetName());
+      }
+    }
+  generated_code += TEXT("        };\r\n");
+  for (int32 i = 0; i < properties.Num(); ++i)
+    {
+    UProperty * property_p = properties[i];
+    const FString property_type_name_cpp = get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue);
+    if (is_apply)
+      {
+      generated_code += FString::Printf(TEXT("      %s value_%d = %s;\r\n"), *property_type_name_cpp, i, *generate_method_parameter_expression(NULL, property_p, i));
+      generated_code += FString::Printf(TEXT("      properties_p[%d]->CopyCompleteValue(properties_p[%d]->ContainerPtrToValuePtr<void>(this_p), &value_%d);\r\n"), i, i, i);
+      }
+    else
+      {
+      if (is_property_read_in_place(property_p))
+        {
+        generated_code += FString::Printf(TEXT("      const %s & value_%d = *properties_p[%d]->ContainerPtrToValuePtr<%s>(this_p);\r\n"), *property_type_name_cpp, i, i, *property_type_name_cpp);
+        }
+      else
+        {
+        FString default_ctor_argument = generate_property_default_ctor_argument(property_p);
+        if (!default_ctor_argument.IsEmpty())
+          {
+          default_ctor_argument = TEXT("(") + default_ctor_argument + TEXT(")");
+          }
+        generated_code += FString::Printf(TEXT("      %s value_%d%s;\r\n"), *property_type_name_cpp, i, *default_ctor_argument);
+        generated_code += FString::Printf(TEXT("      properties_p[%d]->CopyCompleteValue(&value_%d, properties_p[%d]->ContainerPtrToValuePtr<void>(this_p));\r\n"), i, i, i);
+        }
+      generated_code += FString::Printf(TEXT("      scope_p->set_arg(SkArg_%d, SkMarshal<%s>::to_result(value_%d));\r\n"), i + 1, *get_skookum_binding_class_name(property_p), i);
+      }
+    }
+  generated_code += TEXT("      }\r\n");
+  generated_code += TEXT("    }\r\n\r\n");
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_event_subscription(const FString & class_name_cpp, UClass * class_p, UMulticastDelegateProperty * property_p, const MethodBinding & subscribe_binding, const MethodBinding & unsubscribe_binding)
+  {
+  const FString skookum_class_name = get_skookum_class_name(class_p);
+  UFunction * signature_p = property_p->SignatureFunction;
+
+  // Generate script files - the handler is a closure taking the delegate parameters
+  FString handler_params;
+  FString separator;
+  for (TFieldIterator<UProperty> param_it(signature_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    handler_params += separator + get_skookum_property_type_name(param_p) + TEXT(" ") + skookify_var_name(param_p->GetName());
+    separator = TEXT(", ");
+    }
+  FString subscribe_file_path = get_skookum_method_path(class_p, subscribe_binding.m_script_name, false);
+  if (!save_script_file(FString::Printf(TEXT("((%s) handler)\n"), *handler_params), subscribe_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *subscribe_file_path);
+    }
+  FString unsubscribe_file_path = get_skookum_method_path(class_p, unsubscribe_binding.m_script_name, false);
+  if (!save_script_file(FString(TEXT("()\n")), unsubscribe_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *unsubscribe_file_path);
+    }
+
+  // Dispatcher that turns the delegate parameters into handler arguments
+  FString generated_code = FString::Printf(TEXT("  static void dispatch_%s(SkInstance * handler_p, void * params_p)\r\n    {\r\n"), *subscribe_binding.m_code_name);
+  int32 param_count = 0;
+  if (signature_p->Children != NULL)
+    {
+    generated_code += TEXT("    struct FEventParams\r\n      {\r\n");
+    for (TFieldIterator<UProperty> param_it(signature_p); param_it; ++param_it)
+      {
+      UProperty * param_p = *param_it;
+      generated_code += FString::Printf(TEXT("      %s %s;\r\n"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *param_p->GetName());
+      }
+    generated_code += TEXT("      } & params = *static_cast<FEventParams *>(params_p);\r\n");
+    generated_code += TEXT("    SkInstance * args_p[] =\r\n      {\r\n");
+    for (TFieldIterator<UProperty> param_it(signature_p); param_it; ++param_it, ++param_count)
+      {
+      UProperty * param_p = *param_it;
+      generated_code += FString::Printf(TEXT("      SkMarshal<%s>::to_result(params.%s),\r\n"), *get_skookum_binding_class_name(param_p), *param_p->GetName());
+      }
+    generated_code += TEXT("      };\r\n");
+    }
+  generated_code += FString::Printf(TEXT("    SkUEDelegateListener::invoke_handler(handler_p, %s, %d);\r\n"), param_count ? TEXT("args_p") : TEXT("nullptr"), param_count);
+  generated_code += TEXT("    }\r\n\r\n");
+
+  // Subscribe and unsubscribe methods
+  for (int32 is_subscribe = 1; is_subscribe >= 0; --is_subscribe)
+    {
+    const MethodBinding & binding = is_subscribe ? subscribe_binding : unsubscribe_binding;
+    generated_code += FString::Printf(TEXT("  %s\r\n    {\r\n"), *generate_method_binding_declaration(binding.m_code_name, false));
+    generated_code += generate_binding_instrumentation(class_p, binding);
+    generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_initialization(class_name_cpp, class_p, false));
+    generated_code += FString::Printf(TEXT("    %s\r\n"), *generate_this_pointer_assert(FString::Printf(TEXT("Tried to invoke method %s@%s but the %s is null."), *skookum_class_name, *binding.m_script_name, *skookum_class_name)));
+    generated_code += FString::Printf(TEXT("    if (%s)\r\n      {\r\n"), *generate_this_pointer_test());
+    generated_code += FString::Printf(TEXT("      %s\r\n"), *generate_property_lookup(class_p, property_p));
+    if (is_subscribe)
+      {
+      generated_code += FString::Printf(TEXT("      SkUEDelegateListener::subscribe(this_p, static_cast<UMulticastDelegateProperty *>(property_p), scope_p->get_arg(SkArg_1), &dispatch_%s);\r\n"), *subscribe_binding.m_code_name);
+      }
+    else
+      {
+      generated_code += TEXT("      SkUEDelegateListener::unsubscribe(this_p, static_cast<UMulticastDelegateProperty *>(property_p));\r\n");
+      }
+    generated_code += TEXT("      }\r\n");
+    generated_code += TEXT("    }\r\n\r\n");
+    }
+
+  return generated_code;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_method_binding_declaration(const FString & function_name, bool is_static)
+  {
+  return FString::Printf(TEXT("static void mthd%s_%s(SkInvokedMethod * scope_p, SkInstance ** result_pp)"), is_static ? TEXT("c") : TEXT(""), *function_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_binding_instrumentation(UClass * class_p, const MethodBinding & binding)
+  {
+  if (!m_instrument_bindings)
+    {
+    return FString();
+    }
+
+  int32 stat_index = m_binding_stat_names.Add(get_skookum_class_name(class_p) + TEXT("@") + binding.m_script_name);
+  return FString::Printf(TEXT("    SkUEBindingScope binding_scope(binding_stats[%d]);\r\n"), stat_index);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_this_pointer_initialization(const FString & class_name_cpp, UClass * class_p, bool is_static)
+  {
+  FString class_name_skookum = get_skookum_class_name(class_p);
+  if (is_static)
+    {
+    return FString::Printf(TEXT("%s * this_p = static_cast<%s *>(default_object_p);"), *class_name_cpp, *class_name_cpp);
+    }
+  else
+    {
+    return FString::Printf(TEXT("%s * this_p = scope_p->this_as<SkUE%s>();"), *class_name_cpp, *class_name_skookum);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_this_pointer_assert(const FString & message)
+  {
+  // The shipping profile macro drops the message literal along with the check
+  return FString::Printf(TEXT("%s(this_p, \"%s\");"), m_generate_shipping_profile ? TEXT("SK_UE_ASSERT_THIS") : TEXT("SK_ASSERTX"), *message);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_this_pointer_test()
+  {
+  return TEXT("this_p");
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_function_lookup(UFunction * function_p, bool is_thread_safe)
+  {
+  // A lazily initialized static would be written by whichever thread gets there first
+  if (m_generate_shipping_profile || is_thread_safe)
+    {
+    int32 lookup_index = m_function_lookup_names.AddUnique(function_p->GetName());
+    return FString::Printf(TEXT("UFunction * function_p = function_ptrs[%d];"), lookup_index);
+    }
+
+  return FString::Printf(TEXT("static UFunction * function_p = this_p->FindFunctionChecked(TEXT(\"%s\"));"), *function_p->GetName());
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_property_lookup(UClass * class_p, UProperty * property_p)
+  {
+  if (m_generate_shipping_profile)
+    {
+    int32 lookup_index = m_property_lookup_names.AddUnique(property_p->GetName());
+    return FString::Printf(TEXT("UProperty * property_p = property_ptrs[%d];"), lookup_index);
+    }
+
+  return FString::Printf(TEXT("static UProperty * property_p = SkUEClassBindingHelper::find_class_property(SkUE%s::ms_uclass_p, TEXT(\"%s\"));"), *get_skookum_class_name(class_p), *property_p->GetName());
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_method_parameter_expression(UFunction * function_p, UProperty * param_p, int32 ParamIndex)
+  {
+  // Return values and out parameters passed back as return arguments are only written by the function - just value-initialize them
+  if (!(param_p->GetPropertyFlags() & CPF_ReturnParm) && !is_return_arg_param(param_p))
+    {
+    if (get_skookum_property_type(param_p) == SkTypeID_None)
+      {
+      FError::Throwf(TEXT("Unsupported function param type: %s"), *param_p->GetClass()->GetName());
+      }
+
+    return FString::Printf(TEXT("SkMarshal<%s>::from_arg(scope_p, SkArg_%d)"), *get_skookum_binding_class_name(param_p), ParamIndex + 1);
+    }
+  else if (param_p->IsA(UObjectPropertyBase::StaticClass()) || param_p->IsA(UClassProperty::StaticClass()))
+    {
+    return TEXT("nullptr");
+    }
+  else
+    {
+    return FString::Printf(TEXT("%s(%s)"), *get_cpp_property_type_name(param_p, CPPF_ArgumentOrReturnValue), *generate_property_default_ctor_argument(param_p));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_property_default_ctor_argument(UProperty * param_p)
+  {
+  eSkTypeID type_id = get_skookum_property_type(param_p);
+  switch (type_id)
+    {
+    case SkTypeID_Integer:         return TEXT("0");
+    case SkTypeID_Real:            return TEXT("0.0f");
+    case SkTypeID_Boolean:         return TEXT("false");
+    case SkTypeID_String:          
+    case SkTypeID_Name:            
+    case SkTypeID_Transform:       
+    case SkTypeID_UStruct:         
+    case SkTypeID_List:            return TEXT("");
+    case SkTypeID_Vector2:         
+    case SkTypeID_Vector3:         
+    case SkTypeID_Vector4:         
+    case SkTypeID_Rotation:        
+    case SkTypeID_RotationAngles:  
+    case SkTypeID_Color:           return TEXT("ForceInitToZero");
+    case SkTypeID_UClass:          
+    case SkTypeID_UObject:         return TEXT("nullptr");
+    default:                       FError::Throwf(TEXT("Unsupported property type: %s"), *param_p->GetClass()->GetName()); return TEXT("");
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::generate_return_value_passing(UClass * class_p, UFunction * function_p, UProperty * return_value_p, const FString & return_value_name)
+  {
+  if (return_value_p)
+    {
+    if (get_skookum_property_type(return_value_p) == SkTypeID_None)
+      {
+      FError::Throwf(TEXT("Unsupported return param type: %s"), *return_value_p->GetClass()->GetName());
+      }
+
+    if (m_cache_object_wrappers && get_skookum_property_type(return_value_p) == SkTypeID_UObject)
+      {
+      return FString::Printf(TEXT("if (result_pp) *result_pp = SkUEWrapperCache::get_instance<%s>(%s);"), *get_skookum_binding_class_name(return_value_p), *return_value_name);
+      }
+
+    if (function_p && is_thread_safe_function(function_p))
+      {
+      return FString::Printf(TEXT("if (result_pp) *result_pp = SkUEThreadSafety::new_result<%s>(%s);"), *get_skookum_binding_class_name(return_value_p), *return_value_name);
+      }
+
+    return FString::Printf(TEXT("if (result_pp) *result_pp = SkMarshal<%s>::to_result(%s);"), *get_skookum_binding_class_name(return_value_p), *return_value_name);
+    }
+  else
+    {
+    return TEXT(""); // TEXT("if (result_pp) *result_pp = SkBrain::ms_nil_p;");
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_master_binding_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("\r\n");
+
+  generated_code += TEXT("#include \"SkookumScript/SkClass.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkBrain.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkInvokedMethod.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkInteger.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkReal.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkBoolean.hpp\"\r\n");
+  generated_code += TEXT("#include \"SkookumScript/SkString.hpp\"\r\n");
+
+  generated_code += TEXT("\r\n");
+
+  // Include all headers
+  for (auto & header_file_name : m_all_header_file_names)
+    {
+    // Re-base to make sure we're including the right files on a remote machine
+    FString NewFilename(FPaths::GetCleanFilename(header_file_name));
+    generated_code += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+    }
+
+  generated_code += TEXT("\r\n");
+
+  // Include support code used by the bindings
+  generated_code += TEXT("#include \"SkUEMarshal.generated.hpp\"\r\n");
+  if (m_cache_object_wrappers)
+    {
+    generated_code += TEXT("#include \"SkUEWrapperCache.generated.hpp\"\r\n");
+    }
+  if (m_use_descriptor_tables)
+    {
+    generated_code += TEXT("#include \"SkUEDescriptorThunk.generated.hpp\"\r\n");
+    }
+  if (m_generate_batch_bindings)
+    {
+    generated_code += TEXT("#include \"SkUEBatch.generated.hpp\"\r\n");
+    }
+  if (m_instrument_bindings)
+    {
+    generated_code += TEXT("#include \"SkUEBindingStats.generated.hpp\"\r\n");
+    }
+  if (m_generate_shipping_profile)
+    {
+    generated_code += TEXT("#include \"SkUEBindingProfile.generated.hpp\"\r\n");
+    }
+  if (m_generate_thread_safe_bindings)
+    {
+    generated_code += TEXT("#include \"SkUEThreadSafety.generated.hpp\"\r\n");
+    }
+  if (m_generate_event_bindings)
+    {
+    generated_code += TEXT("#include \"SkUEDelegateListener.generated.hpp\"\r\n");
+    }
+  if (m_has_coroutines)
+    {
+    generated_code += TEXT("#include \"SkookumScript/SkInvokedCoroutine.hpp\"\r\n");
+    generated_code += TEXT("#include \"SkUELatentCallback.generated.hpp\"\r\n");
+    }
+
+  generated_code += TEXT("\r\n");
+
+  // Include all bindings
+  for (auto & binding_file_name : m_all_binding_file_names)
+    {
+    // Re-base to make sure we're including the right files on a remote machine
+    FString NewFilename(FPaths::GetCleanFilename(binding_file_name));
+    generated_code += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+    }
+
+  generated_code += TEXT("\r\nnamespace SkUE\r\n  {\r\n\r\n");
+
+  // Classes without StaticClass() must be found by name - do it for all of them in a single pass over all UClasses
+  TArray<UClass *> unresolved_classes;
+  for (auto class_p : m_exported_classes)
+    {
+    if (!does_class_have_static_class(class_p))
+      {
+      unresolved_classes.Add(class_p);
+      }
+    }
+  if (unresolved_classes.Num() > 0)
+    {
+    generated_code += TEXT("  static void resolve_uclasses()\r\n    {\r\n");
+    generated_code += FString::Printf(TEXT("    TMap<FName, UClass **> uclass_slots;\r\n    uclass_slots.Reserve(%d);\r\n"), unresolved_classes.Num());
+    for (auto class_p : unresolved_classes)
+      {
+      generated_code += FString::Printf(TEXT("    uclass_slots.Add(FName(TEXT(\"%s\")), &SkUE%s::ms_uclass_p);\r\n"), *class_p->GetName(), *get_skookum_class_name(class_p));
+      }
+    generated_code += TEXT("    for (TObjectIterator<UClass> class_it; class_it && uclass_slots.Num(); ++class_it)\r\n      {\r\n");
+    generated_code += TEXT("      UClass ** slot_pp = uclass_slots.FindRef(class_it->GetFName());\r\n");
+    generated_code += TEXT("      if (slot_pp)\r\n        {\r\n");
+    generated_code += TEXT("        *slot_pp = *class_it;\r\n");
+    generated_code += TEXT("        uclass_slots.Remove(class_it->GetFName()); // First match wins, like FindObject()\r\n");
+    generated_code += TEXT("        }\r\n");
+    generated_code += TEXT("      }\r\n");
+    generated_code += TEXT("    }\r\n\r\n");
+    }
+
+  generated_code += TEXT("  void register_bindings()\r\n    {\r\n");
+  if (unresolved_classes.Num() > 0)
+    {
+    generated_code += TEXT("    resolve_uclasses();\r\n\r\n");
+    }
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += FString::Printf(TEXT("    SkUE%s::register_bindings();\r\n"), *get_skookum_class_name(class_p));
+    }
+  for (auto struct_p : m_exported_structs)
+    {
+    generated_code += FString::Printf(TEXT("    SkUE%s::register_bindings();\r\n"), *skookify_class_name(struct_p->GetName()));
+    }
+  if (m_entity_coroutine_bindings.Num() > 0)
+    {
+    generated_code += TEXT("    SkUEEntityLatent_Impl::register_bindings();\r\n");
+    }
+  generated_code += FString::Printf(TEXT("\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reserve(%d);\r\n"), m_exported_classes.Num());
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += FString::Printf(TEXT("    SkUEClassBindingHelper::ms_class_map_u2s.Add(SkUE%s::ms_uclass_p, SkUE%s::ms_class_p);\r\n"), *get_skookum_class_name(class_p), *get_skookum_class_name(class_p));
+    }
+  generated_code += FString::Printf(TEXT("\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reserve(%d);\r\n"), m_exported_classes.Num());
+  for (auto class_p : m_exported_classes)
+    {
+    generated_code += FString::Printf(TEXT("    SkUEClassBindingHelper::ms_class_map_s2u.Add(SkUE%s::ms_class_p, SkUE%s::ms_uclass_p);\r\n"), *get_skookum_class_name(class_p), *get_skookum_class_name(class_p));
+    }
+  generated_code += TEXT("\r\n    }\r\n");
+
+  generated_code += TEXT("\r\n  } // SkUE\r\n");
+
+  FString master_binding_file_name = m_binding_code_path / TEXT("SkUE.generated.inl");
+  save_header_if_changed(master_binding_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_marshal_traits_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("#include \"SkookumScript/SkList.hpp\"\r\n\r\n");
+
+  generated_code += TEXT("// Conversion between script arguments/results and C++ values, one specialization per type\r\n");
+  generated_code += TEXT("// Default: The binding class already stores the C++ type\r\n");
+  generated_code += TEXT("template<class _BindingClass>\r\n");
+  generated_code += TEXT("struct SkMarshal\r\n  {\r\n");
+  generated_code += TEXT("  static FORCEINLINE auto from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) -> decltype(scope_p->get_arg<_BindingClass>(arg_idx)) { return scope_p->get_arg<_BindingClass>(arg_idx); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE auto from_instance(SkInstance * instance_p) -> decltype(instance_p->as<_BindingClass>()) { return instance_p->as<_BindingClass>(); }\r\n");
+  generated_code += TEXT("  template<typename _CppType>\r\n");
+  generated_code += TEXT("  static FORCEINLINE SkInstance * to_result(const _CppType & value) { return _BindingClass::new_instance(value); }\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("template<>\r\n");
+  generated_code += TEXT("struct SkMarshal<SkInteger>\r\n  {\r\n");
+  generated_code += TEXT("  static FORCEINLINE int32 from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return int32(scope_p->get_arg<SkInteger>(arg_idx)); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE int32 from_instance(SkInstance * instance_p) { return int32(instance_p->as<SkInteger>()); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE SkInstance * to_result(int32 value) { return SkInteger::new_instance(value); }\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("template<>\r\n");
+  generated_code += TEXT("struct SkMarshal<SkReal>\r\n  {\r\n");
+  generated_code += TEXT("  static FORCEINLINE float from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return float(scope_p->get_arg<SkReal>(arg_idx)); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE float from_instance(SkInstance * instance_p) { return float(instance_p->as<SkReal>()); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE SkInstance * to_result(float value) { return SkReal::new_instance(value); }\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("template<>\r\n");
+  generated_code += TEXT("struct SkMarshal<SkString>\r\n  {\r\n");
+  generated_code += TEXT("  static FORCEINLINE FString from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return FString(scope_p->get_arg<SkString>(arg_idx).as_cstr()); } // $revisit MBreyer - Avoid copy here\r\n");
+  generated_code += TEXT("  static FORCEINLINE FString from_instance(SkInstance * instance_p) { return FString(instance_p->as<SkString>().as_cstr()); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE SkInstance * to_result(const FString & value) { return SkString::new_instance(AString(*value, value.Len())); } // $revisit MBreyer - Avoid copy here\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("// Tag type selecting conversion between a List and a TArray<_ElemType> whose elements are marshaled via _ElemBindingClass\r\n");
+  generated_code += TEXT("template<class _ElemBindingClass, typename _ElemType>\r\n");
+  generated_code += TEXT("struct SkUEList {};\r\n\r\n");
+
+  generated_code += TEXT("template<class _ElemBindingClass, typename _ElemType>\r\n");
+  generated_code += TEXT("struct SkMarshal<SkUEList<_ElemBindingClass, _ElemType>>\r\n  {\r\n");
+  generated_code += TEXT("  // Fills the array with a single allocation and returns it by value (moved, not copied)\r\n");
+  generated_code += TEXT("  static TArray<_ElemType> from_list(const SkInstanceList & list)\r\n    {\r\n");
+  generated_code += TEXT("    const APArray<SkInstance> & instances = list.get_instances();\r\n");
+  generated_code += TEXT("    const uint32 length = instances.get_length();\r\n");
+  generated_code += TEXT("    SkInstance ** instances_pp = instances.get_array();\r\n");
+  generated_code += TEXT("    TArray<_ElemType> values;\r\n");
+  generated_code += TEXT("    values.Reserve(length);\r\n");
+  generated_code += TEXT("    for (uint32 i = 0; i < length; ++i)\r\n      {\r\n");
+  generated_code += TEXT("      values.Add(SkMarshal<_ElemBindingClass>::from_instance(instances_pp[i]));\r\n");
+  generated_code += TEXT("      }\r\n");
+  generated_code += TEXT("    return values;\r\n");
+  generated_code += TEXT("    }\r\n\r\n");
+  generated_code += TEXT("  static FORCEINLINE TArray<_ElemType> from_arg(SkInvokedContextBase * scope_p, uint32 arg_idx) { return from_list(scope_p->get_arg<SkList>(arg_idx)); }\r\n");
+  generated_code += TEXT("  static FORCEINLINE TArray<_ElemType> from_instance(SkInstance * instance_p) { return from_list(instance_p->as<SkList>()); }\r\n\r\n");
+  generated_code += TEXT("  // Reads the elements in place - callers pass the native array directly instead of a copy\r\n");
+  generated_code += TEXT("  static SkInstance * to_result(const TArray<_ElemType> & values)\r\n    {\r\n");
+  generated_code += TEXT("    SkInstance * list_p = SkList::new_instance(values.Num());\r\n");
+  generated_code += TEXT("    SkInstanceList & list = list_p->as<SkList>();\r\n");
+  generated_code += TEXT("    for (const _ElemType & value : values)\r\n      {\r\n");
+  generated_code += TEXT("      list.append(*SkMarshal<_ElemBindingClass>::to_result(value), false); // Take over the reference of the new instance\r\n");
+  generated_code += TEXT("      }\r\n");
+  generated_code += TEXT("    return list_p;\r\n");
+  generated_code += TEXT("    }\r\n");
+  generated_code += TEXT("  };\r\n");
+
+  const FString marshal_file_name = TEXT("SkUEMarshal.generated.hpp");
+  save_header_if_changed(m_binding_code_path / marshal_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_batch_helper_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Conversion between script lists and contiguous arrays for batched bindings\r\n");
+  generated_code += TEXT("class SkUEBatch\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    // Contiguous 16 byte aligned storage for FVector, FQuat and FTransform elements\r\n");
+  generated_code += TEXT("    template<typename _CppType>\r\n");
+  generated_code += TEXT("    using tAlignedArray = TArray<_CppType, TAlignedHeapAllocator<16>>;\r\n\r\n");
+
+  generated_code += TEXT("    // Unpacks list argument arg_idx into values_p - must have one element per receiver\r\n");
+  generated_code += TEXT("    template<class _BindingClass, typename _CppType, typename _Allocator>\r\n");
+  generated_code += TEXT("    static void unpack(SkInvokedMethod * scope_p, uint32 arg_idx, uint32 count, TArray<_CppType, _Allocator> * values_p)\r\n      {\r\n");
+  generated_code += TEXT("      const APArray<SkInstance> & instances = scope_p->get_arg<SkList>(arg_idx).get_instances();\r\n");
+  generated_code += TEXT("      SK_ASSERTX(instances.get_length() == count, \"Batched argument lists must have the same length as the list of receivers.\");\r\n");
+  generated_code += TEXT("      uint32 length = FMath::Min(count, instances.get_length());\r\n");
+  generated_code += TEXT("      SkInstance ** instances_pp = instances.get_array();\r\n");
+  generated_code += TEXT("      values_p->Reset(count);\r\n");
+  generated_code += TEXT("      for (uint32 i = 0; i < length; ++i)\r\n        {\r\n");
+  generated_code += TEXT("        values_p->Add(SkMarshal<_BindingClass>::from_instance(instances_pp[i]));\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      values_p->AddDefaulted(count - length);\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    // Packs values into a new list instance\r\n");
+  generated_code += TEXT("    template<class _BindingClass, typename _CppType>\r\n");
+  generated_code += TEXT("    static SkInstance * pack(const TArray<_CppType> & values)\r\n      {\r\n");
+  generated_code += TEXT("      return SkMarshal<SkUEList<_BindingClass, _CppType>>::to_result(values);\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    template<class _BindingClass, typename _CppType>\r\n");
+  generated_code += TEXT("    static SkInstance * pack(const tAlignedArray<_CppType> & values)\r\n      {\r\n");
+  generated_code += TEXT("      SkInstance * list_p = SkList::new_instance(values.Num());\r\n");
+  generated_code += TEXT("      SkInstanceList & list = list_p->as<SkList>();\r\n");
+  generated_code += TEXT("      for (const _CppType & value : values)\r\n        {\r\n");
+  generated_code += TEXT("        list.append(*SkMarshal<_BindingClass>::to_result(value), false); // Take over the reference of the new instance\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      return list_p;\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString batch_file_name = TEXT("SkUEBatch.generated.hpp");
+  save_header_if_changed(m_binding_code_path / batch_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_binding_stats_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Counters of a single binding\r\n");
+  generated_code += TEXT("struct SkUEBindingStat\r\n  {\r\n");
+  generated_code += TEXT("  uint64 m_call_count;\r\n");
+  generated_code += TEXT("  uint64 m_cycles;\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("// Counts a call and the cycles spent until it goes out of scope\r\n");
+  generated_code += TEXT("struct SkUEBindingScope\r\n  {\r\n");
+  generated_code += TEXT("  FORCEINLINE SkUEBindingScope(SkUEBindingStat & stat) : m_stat(stat), m_start_cycles(FPlatformTime::Cycles()) {}\r\n");
+  generated_code += TEXT("  FORCEINLINE ~SkUEBindingScope() { ++m_stat.m_call_count; m_stat.m_cycles += uint32(FPlatformTime::Cycles() - m_start_cycles); }\r\n\r\n");
+  generated_code += TEXT("  SkUEBindingStat & m_stat;\r\n");
+  generated_code += TEXT("  uint32            m_start_cycles;\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("// Registry of all per-class counter arrays\r\n");
+  generated_code += TEXT("class SkUEBindingStats\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    // Registering the same counters again (e.g. when bindings are re-registered after a script recompile) is ignored\r\n");
+  generated_code += TEXT("    static void register_stats(SkUEBindingStat * stats_p, const TCHAR * const * names_pp, int32 count)\r\n      {\r\n");
+  generated_code += TEXT("      if (!get_classes().ContainsByPredicate([stats_p](const ClassStats & class_stats) { return class_stats.m_stats_p == stats_p; }))\r\n        {\r\n");
+  generated_code += TEXT("        get_classes().Add({ stats_p, names_pp, count });\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    static void reset()\r\n      {\r\n");
+  generated_code += TEXT("      for (auto & class_stats : get_classes())\r\n        {\r\n");
+  generated_code += TEXT("        FMemory::Memzero(class_stats.m_stats_p, class_stats.m_count * sizeof(SkUEBindingStat));\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    // Writes all bindings that have been called, sorted by total time spent\r\n");
+  generated_code += TEXT("    static bool dump(const FString & file_path)\r\n      {\r\n");
+  generated_code += TEXT("      struct Row { const TCHAR * m_name_p; const SkUEBindingStat * m_stat_p; };\r\n");
+  generated_code += TEXT("      TArray<Row> rows;\r\n");
+  generated_code += TEXT("      for (auto & class_stats : get_classes())\r\n        {\r\n");
+  generated_code += TEXT("        for (int32 i = 0; i < class_stats.m_count; ++i)\r\n          {\r\n");
+  generated_code += TEXT("          if (class_stats.m_stats_p[i].m_call_count)\r\n            {\r\n");
+  generated_code += TEXT("            rows.Add({ class_stats.m_names_pp[i], &class_stats.m_stats_p[i] });\r\n");
+  generated_code += TEXT("            }\r\n");
+  generated_code += TEXT("          }\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      rows.Sort([](const Row & a, const Row & b) { return a.m_stat_p->m_cycles > b.m_stat_p->m_cycles; });\r\n\r\n");
+  generated_code += TEXT("      FString report(TEXT(\"total ms,calls,ns/call,binding\\n\"));\r\n");
+  generated_code += TEXT("      for (auto & row : rows)\r\n        {\r\n");
+  generated_code += TEXT("        double total_ms = FPlatformTime::ToMilliseconds64(row.m_stat_p->m_cycles);\r\n");
+  generated_code += TEXT("        report += FString::Printf(TEXT(\"%.3f,%llu,%.1f,%s\\n\"), total_ms, row.m_stat_p->m_call_count, total_ms * 1.0e6 / double(row.m_stat_p->m_call_count), row.m_name_p);\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      return FFileHelper::SaveStringToFile(report, *file_path);\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("  protected:\r\n\r\n");
+
+  generated_code += TEXT("    struct ClassStats\r\n      {\r\n");
+  generated_code += TEXT("      SkUEBindingStat *     m_stats_p;\r\n");
+  generated_code += TEXT("      const TCHAR * const * m_names_pp;\r\n");
+  generated_code += TEXT("      int32                 m_count;\r\n");
+  generated_code += TEXT("      };\r\n\r\n");
+
+  generated_code += TEXT("    static TArray<ClassStats> & get_classes() { static TArray<ClassStats> s_classes; return s_classes; }\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString stats_file_name = TEXT("SkUEBindingStats.generated.hpp");
+  save_header_if_changed(m_binding_code_path / stats_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_thread_safety_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Registry of the bindings of the static functions listed as ThreadSafeFunctions in the generator settings\r\n");
+  generated_code += TEXT("// These use neither lazily initialized statics nor shared mutable state and take and return plain values only\r\n");
+  generated_code += TEXT("// Filled by register_bindings() on the game thread and only read afterwards, so queries are safe from any thread\r\n");
+  generated_code += TEXT("class SkUEThreadSafety\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    static void register_methods(uint32 class_name_id, const uint32 * method_name_ids_p, int32 count)\r\n      {\r\n");
+  generated_code += TEXT("      for (int32 i = 0; i < count; ++i)\r\n        {\r\n");
+  generated_code += TEXT("        get_methods().Add(get_key(class_name_id, method_name_ids_p[i]));\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    // If the binding of the given method may be invoked on a worker thread\r\n");
+  generated_code += TEXT("    static bool is_thread_safe(uint32 class_name_id, uint32 method_name_id)\r\n      {\r\n");
+  generated_code += TEXT("      return get_methods().Contains(get_key(class_name_id, method_name_id));\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    // Creates the result of a thread safe binding without going through the (game thread only) instance pool\r\n");
+  generated_code += TEXT("    // Provided by the runtime plugin, as only it knows how its instances get allocated and freed\r\n");
+  generated_code += TEXT("    template<class _BindingClass, typename _CppType>\r\n");
+  generated_code += TEXT("    static SkInstance * new_result(const _CppType & value);\r\n\r\n");
+
+  generated_code += TEXT("  protected:\r\n\r\n");
+
+  generated_code += TEXT("    static FORCEINLINE uint64 get_key(uint32 class_name_id, uint32 method_name_id) { return (uint64(class_name_id) << 32) | method_name_id; }\r\n");
+  generated_code += TEXT("    static TSet<uint64> & get_methods() { static TSet<uint64> s_methods; return s_methods; }\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString thread_safety_file_name = TEXT("SkUEThreadSafety.generated.hpp");
+  save_header_if_changed(m_binding_code_path / thread_safety_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_delegate_listener_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Called by the listener when the delegate is broadcast - params_p points to the delegate's parameter block\r\n");
+  generated_code += TEXT("typedef void (*tSkUEDelegateDispatch)(SkInstance * handler_p, void * params_p);\r\n\r\n");
+
+  generated_code += TEXT("// Interface the generated event bindings call into - only declared here, the runtime plugin provides the definitions\r\n");
+  generated_code += TEXT("// All functions are called on the game thread only\r\n");
+  generated_code += TEXT("class SkUEDelegateListener\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    // Adds a listener to the multicast delegate property_p of obj_p that calls dispatch_f with handler_p on each broadcast\r\n");
+  generated_code += TEXT("    // References handler_p until it is unsubscribed or obj_p is destroyed - a second subscribe replaces the first\r\n");
+  generated_code += TEXT("    static void subscribe(UObject * obj_p, UMulticastDelegateProperty * property_p, SkInstance * handler_p, tSkUEDelegateDispatch dispatch_f);\r\n\r\n");
+
+  generated_code += TEXT("    // Removes the listener added by subscribe() and dereferences its handler - does nothing if there is none\r\n");
+  generated_code += TEXT("    static void unsubscribe(UObject * obj_p, UMulticastDelegateProperty * property_p);\r\n\r\n");
+
+  generated_code += TEXT("    // Invokes the handler closure with the given arguments and takes over the references held by args_pp\r\n");
+  generated_code += TEXT("    static void invoke_handler(SkInstance * handler_p, SkInstance ** args_pp, int32 arg_count);\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString delegate_listener_file_name = TEXT("SkUEDelegateListener.generated.hpp");
+  save_header_if_changed(m_binding_code_path / delegate_listener_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_latent_callback_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Interface the generated coroutine bindings call into - only declared here, the runtime plugin provides the definitions\r\n");
+  generated_code += TEXT("// All functions are called on the game thread only\r\n");
+  generated_code += TEXT("class SkUELatentCallback\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    // Returns latent info whose completion callback resumes the suspended coroutine scope_p\r\n");
+  generated_code += TEXT("    // The callback must check that scope_p is still waiting on this action - it may have been aborted in the meantime\r\n");
+  generated_code += TEXT("    static FLatentActionInfo make_latent_info(SkInvokedCoroutine * scope_p);\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString latent_callback_file_name = TEXT("SkUELatentCallback.generated.hpp");
+  save_header_if_changed(m_binding_code_path / latent_callback_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_wrapper_cache_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Script instances wrapping UObjects, reused across calls returning the same object\r\n");
+  generated_code += TEXT("// Entries are keyed by object address and dropped as soon as the object is deleted, so neither dead\r\n");
+  generated_code += TEXT("// wrappers pile up nor does a new object reusing the address get handed a stale one\r\n");
+  generated_code += TEXT("class SkUEWrapperCache\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    template<class _BindingClass, typename _UObjectType>\r\n");
+  generated_code += TEXT("    static SkInstance * get_instance(_UObjectType * obj_p)\r\n      {\r\n");
+  generated_code += TEXT("      if (!obj_p)\r\n        {\r\n");
+  generated_code += TEXT("        return _BindingClass::new_instance(obj_p);\r\n");
+  generated_code += TEXT("        }\r\n\r\n");
+  generated_code += TEXT("      Entry & entry = get_entries().FindOrAdd(obj_p);\r\n");
+  generated_code += TEXT("      if (entry.m_instance_p && entry.m_object.Get() == obj_p && entry.m_instance_p->get_class() == _BindingClass::ms_class_p)\r\n        {\r\n");
+  generated_code += TEXT("        ++get_hit_count();\r\n");
+  generated_code += TEXT("        entry.m_instance_p->reference(); // One reference for the caller, the cache keeps its own\r\n");
+  generated_code += TEXT("        return entry.m_instance_p;\r\n");
+  generated_code += TEXT("        }\r\n\r\n");
+  generated_code += TEXT("      ++get_miss_count();\r\n");
+  generated_code += TEXT("      if (entry.m_instance_p)\r\n        {\r\n");
+  generated_code += TEXT("        entry.m_instance_p->dereference();\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      SkInstance * instance_p = _BindingClass::new_instance(obj_p);\r\n");
+  generated_code += TEXT("      instance_p->reference();\r\n");
+  generated_code += TEXT("      entry.m_object = obj_p;\r\n");
+  generated_code += TEXT("      entry.m_instance_p = instance_p;\r\n");
+  generated_code += TEXT("      if (!get_is_listening())\r\n        {\r\n");
+  generated_code += TEXT("        GUObjectArray.AddUObjectDeleteListener(&get_delete_listener());\r\n");
+  generated_code += TEXT("        get_is_listening() = true;\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      return instance_p;\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    // Releases all wrappers and stops listening for deleted objects, e.g. when the script runtime shuts down\r\n");
+  generated_code += TEXT("    static void clear()\r\n      {\r\n");
+  generated_code += TEXT("      for (auto & entry : get_entries())\r\n        {\r\n");
+  generated_code += TEXT("        entry.Value.m_instance_p->dereference();\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      get_entries().Reset();\r\n");
+  generated_code += TEXT("      if (get_is_listening())\r\n        {\r\n");
+  generated_code += TEXT("        GUObjectArray.RemoveUObjectDeleteListener(&get_delete_listener());\r\n");
+  generated_code += TEXT("        get_is_listening() = false;\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    static uint64 & get_hit_count()  { static uint64 s_hit_count = 0u; return s_hit_count; }   // Calls that returned a cached wrapper\r\n");
+  generated_code += TEXT("    static uint64 & get_miss_count() { static uint64 s_miss_count = 0u; return s_miss_count; } // Calls that had to allocate a new wrapper\r\n\r\n");
+
+  generated_code += TEXT("  protected:\r\n\r\n");
+
+  generated_code += TEXT("    struct Entry\r\n      {\r\n");
+  generated_code += TEXT("      FWeakObjectPtr m_object;\r\n");
+  generated_code += TEXT("      SkInstance *   m_instance_p = nullptr;\r\n");
+  generated_code += TEXT("      };\r\n\r\n");
+
+  generated_code += TEXT("    // Called by the garbage collector on the game thread for every object it deletes\r\n");
+  generated_code += TEXT("    class DeleteListener : public FUObjectArray::FUObjectDeleteListener\r\n      {\r\n");
+  generated_code += TEXT("      public:\r\n");
+  generated_code += TEXT("        virtual void NotifyUObjectDeleted(const UObjectBase * object_p) override\r\n          {\r\n");
+  generated_code += TEXT("          Entry entry;\r\n");
+  generated_code += TEXT("          if (get_entries().RemoveAndCopyValue(static_cast<const UObject *>(object_p), entry))\r\n            {\r\n");
+  generated_code += TEXT("            entry.m_instance_p->dereference();\r\n");
+  generated_code += TEXT("            }\r\n");
+  generated_code += TEXT("          }\r\n");
+  generated_code += TEXT("      };\r\n\r\n");
+
+  generated_code += TEXT("    static TMap<const UObject *, Entry> & get_entries() { static TMap<const UObject *, Entry> s_entries; return s_entries; }\r\n\r\n");
+
+  generated_code += TEXT("    // Never destroyed - GUObjectArray may still notify it while static objects are being torn down\r\n");
+  generated_code += TEXT("    static DeleteListener & get_delete_listener() { static DeleteListener * s_listener_p = new DeleteListener; return *s_listener_p; }\r\n");
+  generated_code += TEXT("    static bool & get_is_listening() { static bool s_is_listening = false; return s_is_listening; }\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString cache_file_name = TEXT("SkUEWrapperCache.generated.hpp");
+  save_header_if_changed(m_binding_code_path / cache_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_binding_profile_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  generated_code += TEXT("// Shipping builds drop the asserts on null objects along with their message literals\r\n");
+  generated_code += TEXT("// The null tests guarding the calls stay in, so a null receiver is still skipped rather than dereferenced\r\n");
+  generated_code += TEXT("#if UE_BUILD_SHIPPING\r\n");
+  generated_code += TEXT("  #define SK_UE_ASSERT_THIS(_this_p, _message)\r\n");
+  generated_code += TEXT("#else\r\n");
+  generated_code += TEXT("  #define SK_UE_ASSERT_THIS(_this_p, _message) SK_ASSERTX(_this_p, _message)\r\n");
+  generated_code += TEXT("#endif\r\n");
+
+  const FString profile_file_name = TEXT("SkUEBindingProfile.generated.hpp");
+  save_header_if_changed(m_binding_code_path / profile_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::generate_descriptor_thunk_file()
+  {
+  FString generated_code;
+
+  generated_code += TEXT("#pragma once\r\n\r\n");
+
+  // Parameter types - generated from ms_sk_type_id_names so the values always match eSkTypeID
+  generated_code += TEXT("enum eSkUEParamType\r\n  {\r\n");
+  for (uint32 type_id = 0; type_id < SkTypeID__Count; ++type_id)
+    {
+    generated_code += FString::Printf(TEXT("  SkUEParamType_%s = %d,\r\n"), *ms_sk_type_id_names[type_id], type_id);
+    }
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("struct SkUEParamDescriptor\r\n  {\r\n");
+  generated_code += TEXT("  uint16 m_type;   // eSkUEParamType\r\n");
+  generated_code += TEXT("  uint16 m_offset; // Byte offset into the parameter block passed to ProcessEvent()\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("struct SkUEMethodDescriptor\r\n  {\r\n");
+  generated_code += TEXT("  const TCHAR *               m_function_name_p; // Name of the UFunction to invoke\r\n");
+  generated_code += TEXT("  UObject * const *           m_default_object_pp; // Cached class default object static functions get invoked on, nullptr for instance functions\r\n");
+  generated_code += TEXT("  UObject *                (* m_get_this_f)(SkInvokedMethod * scope_p); // Fetches the receiver through the binding class of the row's class, nullptr for static functions\r\n");
+  generated_code += TEXT("  UFunction **                m_function_pp;     // Slot caching the UFunction once it has been looked up\r\n");
+  generated_code += TEXT("  const SkUEParamDescriptor * m_params_p;        // Arguments in SkArg_1.. order\r\n");
+  generated_code += TEXT("  uint16                      m_param_count;\r\n");
+  generated_code += TEXT("  uint16                      m_params_size;     // Size of the parameter block, 0 if neither arguments nor return value\r\n");
+  generated_code += TEXT("  SkUEParamDescriptor         m_return;          // SkUEParamType_nil if no return value\r\n");
+  generated_code += TEXT("  SkInstance *             (* m_wrap_object_f)(UObject * obj_p); // Creates the script instance for SkUEParamType_Entity return values\r\n");
+  generated_code += TEXT("  bool                        m_is_static;\r\n");
+  generated_code += TEXT("  };\r\n\r\n");
+
+  generated_code += TEXT("// Shared invocation code for all methods bound via descriptor tables\r\n");
+  generated_code += TEXT("class SkUEDescriptorThunk\r\n  {\r\n");
+  generated_code += TEXT("  public:\r\n\r\n");
+
+  generated_code += TEXT("    template<class _BindingClass>\r\n");
+  generated_code += TEXT("    static UObject * get_this(SkInvokedMethod * scope_p) { return scope_p->this_as<_BindingClass>(); }\r\n\r\n");
+
+  generated_code += TEXT("    template<class _BindingClass, class _UObjectType>\r\n");
+  if (m_cache_object_wrappers)
+    {
+    generated_code += TEXT("    static SkInstance * wrap_object(UObject * obj_p) { return SkUEWrapperCache::get_instance<_BindingClass>(static_cast<_UObjectType *>(obj_p)); }\r\n\r\n");
+    }
+  else
+    {
+    generated_code += TEXT("    static SkInstance * wrap_object(UObject * obj_p) { return _BindingClass::new_instance(static_cast<_UObjectType *>(obj_p)); }\r\n\r\n");
+    }
+
+  generated_code += TEXT("    static void invoke(const SkUEMethodDescriptor & desc, SkInvokedMethod * scope_p, SkInstance ** result_pp)\r\n      {\r\n");
+  generated_code += TEXT("      UObject * this_p = desc.m_is_static ? *desc.m_default_object_pp : (*desc.m_get_this_f)(scope_p);\r\n");
+  generated_code += TEXT("      uint8 * params_p = desc.m_params_size ? (uint8 *)FMemory_Alloca(desc.m_params_size) : nullptr;\r\n");
+  generated_code += TEXT("      FMemory::Memzero(params_p, desc.m_params_size); // Zero is a valid empty state for all supported types\r\n");
+  generated_code += TEXT("      for (uint32 i = 0; i < desc.m_param_count; ++i)\r\n        {\r\n");
+  generated_code += TEXT("        fetch_arg(desc.m_params_p[i], params_p, scope_p, i);\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      SK_ASSERTX(this_p, a_cstr_format(\"Tried to invoke method %ls but the object is null.\", desc.m_function_name_p));\r\n");
+  generated_code += TEXT("      if (this_p)\r\n        {\r\n");
+  generated_code += TEXT("        UFunction * function_p = *desc.m_function_pp;\r\n");
+  generated_code += TEXT("        if (!function_p)\r\n          {\r\n");
+  generated_code += TEXT("          function_p = *desc.m_function_pp = this_p->FindFunctionChecked(desc.m_function_name_p);\r\n");
+  generated_code += TEXT("          }\r\n");
+  generated_code += TEXT("        check(function_p->ParmsSize <= desc.m_params_size);\r\n");
+  generated_code += TEXT("        this_p->ProcessEvent(function_p, params_p);\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      if (result_pp && desc.m_return.m_type != SkUEParamType_nil)\r\n        {\r\n");
+  generated_code += TEXT("        *result_pp = new_result(desc, params_p);\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      // Strings are the only supported types that own memory\r\n");
+  generated_code += TEXT("      for (uint32 i = 0; i < desc.m_param_count; ++i)\r\n        {\r\n");
+  generated_code += TEXT("        if (desc.m_params_p[i].m_type == SkUEParamType_String) ((FString *)(params_p + desc.m_params_p[i].m_offset))->~FString();\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      if (desc.m_return.m_type == SkUEParamType_String) ((FString *)(params_p + desc.m_return.m_offset))->~FString();\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("  protected:\r\n\r\n");
+
+  generated_code += TEXT("    static void fetch_arg(const SkUEParamDescriptor & param, uint8 * params_p, SkInvokedMethod * scope_p, uint32 arg_idx)\r\n      {\r\n");
+  generated_code += TEXT("      void * value_p = params_p + param.m_offset;\r\n");
+  generated_code += TEXT("      switch (param.m_type)\r\n        {\r\n");
+  generated_code += TEXT("        case SkUEParamType_Integer:         *(int32 *)value_p = SkMarshal<SkInteger>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Real:            *(float *)value_p = SkMarshal<SkReal>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Boolean:         *(bool *)value_p = SkMarshal<SkBoolean>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_String:          *(FString *)value_p = SkMarshal<SkString>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Name:            *(FName *)value_p = SkMarshal<SkUEName>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector2:         *(FVector2D *)value_p = SkMarshal<SkVector2>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector3:         *(FVector *)value_p = SkMarshal<SkVector3>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector4:         *(FVector4 *)value_p = SkMarshal<SkVector4>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Rotation:        *(FQuat *)value_p = SkMarshal<SkRotation>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_RotationAngles:  *(FRotator *)value_p = SkMarshal<SkRotationAngles>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Transform:       *(FTransform *)value_p = SkMarshal<SkTransform>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Color:           *(FLinearColor *)value_p = SkMarshal<SkColor>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_EntityClass:     *(UClass **)value_p = SkMarshal<SkUEEntityClass>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        case SkUEParamType_Entity:          *(UObject **)value_p = SkMarshal<SkUEEntity>::from_arg(scope_p, SkArg_1 + arg_idx); break;\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("    static SkInstance * new_result(const SkUEMethodDescriptor & desc, uint8 * params_p)\r\n      {\r\n");
+  generated_code += TEXT("      void * value_p = params_p + desc.m_return.m_offset;\r\n");
+  generated_code += TEXT("      switch (desc.m_return.m_type)\r\n        {\r\n");
+  generated_code += TEXT("        case SkUEParamType_Integer:         return SkMarshal<SkInteger>::to_result(*(int32 *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Real:            return SkMarshal<SkReal>::to_result(*(float *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Boolean:         return SkMarshal<SkBoolean>::to_result(*(bool *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_String:          return SkMarshal<SkString>::to_result(*(FString *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Name:            return SkMarshal<SkUEName>::to_result(*(FName *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector2:         return SkMarshal<SkVector2>::to_result(*(FVector2D *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector3:         return SkMarshal<SkVector3>::to_result(*(FVector *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Vector4:         return SkMarshal<SkVector4>::to_result(*(FVector4 *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Rotation:        return SkMarshal<SkRotation>::to_result(*(FQuat *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_RotationAngles:  return SkMarshal<SkRotationAngles>::to_result(*(FRotator *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Transform:       return SkMarshal<SkTransform>::to_result(*(FTransform *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Color:           return SkMarshal<SkColor>::to_result(*(FLinearColor *)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_EntityClass:     return SkMarshal<SkUEEntityClass>::to_result(*(UClass **)value_p);\r\n");
+  generated_code += TEXT("        case SkUEParamType_Entity:          return (*desc.m_wrap_object_f)(*(UObject **)value_p);\r\n");
+  generated_code += TEXT("        }\r\n");
+  generated_code += TEXT("      return SkBrain::ms_nil_p;\r\n");
+  generated_code += TEXT("      }\r\n\r\n");
+
+  generated_code += TEXT("  };\r\n");
+
+  const FString thunk_file_name = TEXT("SkUEDescriptorThunk.generated.hpp");
+  save_header_if_changed(m_binding_code_path / thunk_file_name, generated_code);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_export_class(UClass * class_p, const FString & source_header_file_name) const
+  {
+  FString class_name = *class_p->GetName();
+
+  return does_class_have_static_class(class_p) // Don't export classes that don't export DLL symbols
+    && !m_exported_classes.Contains(class_p) // Don't export classes that have already been exported
+    && !m_skip_classes.Contains(class_name); // Don't export classes that set to skip in UHT config file
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_export_method(UClass * class_p, UFunction * function_p) const
+  {
+  // If this function is inherited, do nothing as SkookumScript will inherit it for us
+  if (function_p->GetOwnerClass() != class_p)
+    return false;
+
+  // We don't support delegates and non-public functions
+  if ((function_p->FunctionFlags & FUNC_Delegate))
+    {
+    return false;
+    }
+
+  // Latent functions become coroutines which can't pass back a return value
+  // A LatentInfo parameter without Latent metadata is left to the checks below like any other struct
+  UProperty * latent_info_param_p = is_latent_function(function_p) ? get_latent_info_param(function_p) : nullptr;
+  if (latent_info_param_p && (!m_generate_coroutines || function_p->GetReturnProperty()))
+    {
+    return false;
+    }
+
+  // Nor out parameters - the latent action writes them on completion, long after the parameters of the starting call are gone
+  if (latent_info_param_p)
+    {
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      if (is_out_param(*param_it))
+        {
+        return false;
+        }
+      }
+    }
+
+  // Reject if any of the parameter types is unsupported yet
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+
+    // The latent info is filled in by the coroutine binding
+    if (param_p == latent_info_param_p)
+      {
+      continue;
+      }
+
+    if (param_p->ArrayDim > 1 ||
+      param_p->IsA(UDelegateProperty::StaticClass()) ||
+      param_p->IsA(UMulticastDelegateProperty::StaticClass()) ||
+      param_p->IsA(UWeakObjectProperty::StaticClass()) ||
+      param_p->IsA(UInterfaceProperty::StaticClass()))
+      {
+      return false;
+      }
+
+    if (!is_property_type_supported(param_p))
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_export_property(UClass * class_p, UProperty * property_p) const
+  {
+  // If this property is inherited, do nothing as SkookumScript will inherit it for us
+  if (property_p->GetOwnerClass() != class_p)
+    return false;
+
+  // Check if property type is supported
+  return is_property_type_supported(property_p);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_export_event(UClass * class_p, UProperty * property_p) const
+  {
+  // If this delegate is inherited, do nothing as SkookumScript will inherit it for us
+  if (property_p->GetOwnerClass() != class_p)
+    return false;
+
+  // Only multicast delegates that blueprints may bind to
+  UMulticastDelegateProperty * delegate_property_p = Cast<UMulticastDelegateProperty>(property_p);
+  if (!delegate_property_p || !(property_p->PropertyFlags & CPF_BlueprintAssignable) || !delegate_property_p->SignatureFunction)
+    {
+    return false;
+    }
+
+  // Reject if any of the parameter types is unsupported yet
+  for (TFieldIterator<UProperty> param_it(delegate_property_p->SignatureFunction); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (param_p->ArrayDim > 1 || !is_property_type_supported(param_p))
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_latent_function(UFunction * function_p)
+  {
+  return function_p->HasMetaData(TEXT("Latent")) && get_latent_info_param(function_p) != nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_thread_safe_function(UFunction * function_p) const
+  {
+  if (!m_generate_thread_safe_bindings || is_latent_function(function_p))
+    {
+    return false;
+    }
+
+  // Neither FUNC_Const nor FUNC_BlueprintPure says anything about what the C++ implementation touches (e.g. the random
+  // functions of the math library share one seed), so only functions explicitly listed in the ini file qualify
+  const TArray<FString> * function_names_p = m_thread_safe_functions.Find(function_p->GetOwnerClass()->GetName());
+  if (!function_names_p
+   || !(function_names_p->Contains(function_p->GetName()) || function_names_p->Contains(TEXT("*"))))
+    {
+    return false;
+    }
+
+  // A member function would read its object while the game thread may be changing it
+  if (!function_p->HasAllFunctionFlags(FUNC_Static | FUNC_BlueprintPure))
+    {
+    return false;
+    }
+
+  // Bindings updating shared counters or caches would race
+  if (m_instrument_bindings || is_memoized_function(function_p))
+    {
+    return false;
+    }
+
+  // Plain values in and out only - objects, strings, names and lists all reach into shared engine state,
+  // and the single result is created by SkUEThreadSafety::new_result() rather than from the instance pool
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    if (is_out_param(*param_it))
+      {
+      return false;
+      }
+    switch (get_skookum_property_type(*param_it))
+      {
+      case SkTypeID_Integer:
+      case SkTypeID_Real:
+      case SkTypeID_Boolean:
+      case SkTypeID_Vector2:
+      case SkTypeID_Vector3:
+      case SkTypeID_Vector4:
+      case SkTypeID_Rotation:
+      case SkTypeID_RotationAngles:
+      case SkTypeID_Transform:
+      case SkTypeID_Color:
+        break;
+      default:
+        return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_out_param(UProperty * param_p)
+  {
+  // Const references and UPARAM(ref) parameters are also flagged CPF_OutParm but carry a value into the function
+  return param_p->HasAnyPropertyFlags(CPF_OutParm)
+    && !param_p->HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm | CPF_ReferenceParm);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_return_arg_param(UProperty * param_p) const
+  {
+  // Otherwise out parameters stay regular arguments as they always were
+  return m_return_out_params && is_out_param(param_p);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::has_return_arg_params(UFunction * function_p) const
+  {
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    if (is_return_arg_param(*param_it))
+      {
+      return true;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_memoized_function(UFunction * function_p) const
+  {
+  // Opted in by the class declaring the function, so the setting carries over to all subclasses
+  const TArray<FString> * function_names_p = m_memoized_functions.Find(function_p->GetOwnerClass()->GetName());
+  if (!function_names_p
+   || !(function_names_p->Contains(function_p->GetName()) || function_names_p->Contains(TEXT("*"))))
+    {
+    return false;
+    }
+
+  // Only a pure function with nothing but a return value gives the same result for the same object within a frame
+  if (!function_p->HasAnyFunctionFlags(FUNC_BlueprintPure) || is_latent_function(function_p))
+    {
+    return false;
+    }
+  bool has_return_value = false;
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    if (!param_it->HasAnyPropertyFlags(CPF_ReturnParm))
+      {
+      return false;
+      }
+    has_return_value = true;
+    }
+  return has_return_value;
+  }
+
+//---------------------------------------------------------------------------------------
+
+UProperty * FSkookumScriptGenerator::get_latent_info_param(UFunction * function_p)
+  {
+  const FString & latent_info_param_name = function_p->GetMetaData(TEXT("LatentInfo"));
+  if (!latent_info_param_name.IsEmpty())
+    {
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      if (param_it->GetName() == latent_info_param_name)
+        {
+        return *param_it;
+        }
+      }
+    }
+
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_use_method_descriptor(UFunction * function_p) const
+  {
+  // The shared thunk assumes one fixed C++ type per eSkTypeID - FColor is the only exception as it shares SkTypeID_Color with FLinearColor
+  // Arrays and generated structs need their specific type to be marshaled so they are left to unrolled bindings
+  static FName name_LinearColor("LinearColor");
+  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+    {
+    UProperty * param_p = *param_it;
+    if (get_skookum_property_type(param_p) == SkTypeID_List || get_skookum_property_type(param_p) == SkTypeID_UStruct)
+      {
+      return false;
+      }
+    if (is_return_arg_param(param_p))
+      {
+      return false; // The thunk does not pass back return arguments
+      }
+    if (get_skookum_property_type(param_p) == SkTypeID_Color
+     && CastChecked<UStructProperty>(param_p)->Struct->GetFName() != name_LinearColor)
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::does_class_have_static_class(UClass * class_p)
+  {
+  return !!(class_p->ClassFlags & (CLASS_RequiredAPI | CLASS_MinimalAPI));
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::can_export_struct(UScriptStruct * struct_p)
+  {
+  // Must be declared in C++ so generated code can name it
+  if (!(struct_p->StructFlags & STRUCT_Native) || (struct_p->StructFlags & STRUCT_NoExport))
+    {
+    return false;
+    }
+
+  // The generated class shares one namespace (and the Object/ script folder) with all classes - skip the struct if its name is taken
+  // by a class or by a struct of another module, otherwise their script files would end up mixed in the same folder
+  const FString & struct_name = struct_p->GetName();
+  if (FindObject<UClass>(ANY_PACKAGE, *struct_name) || FindObject<UScriptStruct>(ANY_PACKAGE, *struct_name) != struct_p)
+    {
+    return false;
+    }
+  const FString skookum_struct_name = skookify_class_name(struct_name);
+  for (uint32 type_id = 0; type_id < SkTypeID__Count; ++type_id)
+    {
+    if (ms_sk_type_id_names[type_id] == skookum_struct_name)
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_struct_include_path(UScriptStruct * struct_p)
+  {
+  // UHT records the declaring header relative to its module - like the IncludePath of classes, the include path omits the Classes/Public/Private folder
+  FString include_path = struct_p->GetMetaData(TEXT("ModuleRelativePath"));
+  for (const TCHAR * folder_p : { TEXT("Classes/"), TEXT("Public/"), TEXT("Private/") })
+    {
+    if (include_path.RemoveFromStart(folder_p))
+      {
+      break;
+      }
+    }
+  return include_path;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_property_type_supported(UProperty * property_p) const
+  {
+  // Arrays are supported if their elements are
+  UArrayProperty * array_property_p = Cast<UArrayProperty>(property_p);
+  if (array_property_p && !is_property_type_supported(array_property_p->Inner))
+    {
+    return false;
+    }
+
+  if (property_p->IsA(ULazyObjectProperty::StaticClass())
+    || property_p->IsA(UAssetObjectProperty::StaticClass())
+    || property_p->IsA(UAssetClassProperty::StaticClass())
+    || property_p->IsA(UWeakObjectProperty::StaticClass()))
+    {
+    return false;
+    }
+
+  return (get_skookum_property_type(property_p) != SkTypeID_None);
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_property_read_in_place(UProperty * property_p) const
+  {
+  // Worth it for anything bigger than a scalar - booleans can't be referenced anyway as they might be bitfields
+  switch (get_skookum_property_type(property_p))
+    {
+    case SkTypeID_Vector2:
+    case SkTypeID_Vector3:
+    case SkTypeID_Vector4:
+    case SkTypeID_Rotation:
+    case SkTypeID_RotationAngles:
+    case SkTypeID_Transform:
+    case SkTypeID_Color:
+    case SkTypeID_UStruct:
+    case SkTypeID_List:            return true;
+    default:                       return false;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::skookify_class_name(const FString & name)
+  {
+  if (name == TEXT("Object")) return TEXT("Entity");
+  if (name == TEXT("Class"))  return TEXT("EntityClass");
+  if (name == TEXT("Enum"))   return TEXT("Enum2"); // HACK
+
+  return name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::is_reserved_keyword(const FString & name)
+  {
+  // Perfect hash over ms_reserved_keywords - first character, last character and length tell all of them apart
+  enum { KeywordTableSize = 128 };
+  struct KeywordTable
+    {
+    static uint32 hash(const TCHAR * name_p, int32 length) { return (uint32(name_p[0]) + uint32(name_p[length - 1]) * 13u + uint32(length) * 3u) & (KeywordTableSize - 1); }
+
+    KeywordTable()
+      {
+      FMemory::Memzero(m_keywords);
+      for (auto keyword_p : ms_reserved_keywords)
+        {
+        uint32 index = hash(keyword_p, FCString::Strlen(keyword_p));
+        check(!m_keywords[index]); // If this fires, a new keyword collides - pick new hash factors
+        m_keywords[index] = keyword_p;
+        }
+      }
+
+    const TCHAR * m_keywords[KeywordTableSize];
+    };
+  static const KeywordTable keyword_table;
+
+  if (name.IsEmpty()) return false;
+  const TCHAR * keyword_p = keyword_table.m_keywords[KeywordTable::hash(*name, name.Len())];
+  return keyword_p && FCString::Strcmp(keyword_p, *name) == 0;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::skookify_var_name(const FString & name, bool * is_boolean_p)
+  {
+  if (name.IsEmpty()) return name;
+
+  // The same names come up over and over again across classes, so remember each one converted
+  static TMap<FString, VarName, FDefaultSetAllocator, NameKeyFuncs<VarName>> var_name_cache;
+  const VarName * cached_p = var_name_cache.Find(name);
+  if (cached_p)
+    {
+    if (is_boolean_p) *is_boolean_p = cached_p->m_is_boolean;
+    return cached_p->m_skookum_name;
+    }
+
+  // Change title case to lower case with underscores
+  FString skookum_name;
+  skookum_name.Reserve(name.Len() + 16);
+  bool is_boolean = name[0] == 'b' && isupper(name[1]);
+  bool was_upper = true;
+  bool was_underscore = true;
+  for (int32 i = int32(is_boolean); i < name.Len(); ++i)
+    {
+    TCHAR c = name[i];
+    bool is_upper = isupper(c) != 0 || isdigit(c) != 0;
+    if (is_upper && !was_upper && !was_underscore)
+      {
+      skookum_name.AppendChar('_');
+      }
+    skookum_name.AppendChar(tolower(c));
+    was_upper = is_upper;
+    was_underscore = (c == TCHAR('_'));
+    }
+
+  // Check for reserved keywords and append underscore if found
+  if (is_reserved_keyword(skookum_name))
+    {
+    skookum_name.AppendChar('_');
+    }
+
+  var_name_cache.Add(name, { skookum_name, is_boolean });
+  if (is_boolean_p) *is_boolean_p = is_boolean;
+  return skookum_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::skookify_method_name(const FString & name, UProperty * return_property_p)
+  {
+  // The result only depends on the name and on whether a boolean is returned, so cache by both
+  const bool returns_boolean = return_property_p && return_property_p->IsA(UBoolProperty::StaticClass());
+  static TMap<FString, FString, FDefaultSetAllocator, NameKeyFuncs<FString>> method_name_cache[2];
+  const FString * cached_p = method_name_cache[returns_boolean].Find(name);
+  if (cached_p)
+    {
+    return *cached_p;
+    }
+
+  bool is_boolean = false;
+  FString method_name = skookify_var_name(name, &is_boolean);
+
+  // Remove K2 (Kismet 2) prefix if present
+  method_name.RemoveFromStart(TEXT("k2_"), ESearchCase::CaseSensitive);
+
+  // If name starts with "get_", remove it
+  if (method_name.RemoveFromStart(TEXT("get_"), ESearchCase::CaseSensitive))
+    {
+    // Append question mark
+    is_boolean = true;
+    }
+  // If name starts with "set_", remove it and append "_set" instead
+  else if (method_name.RemoveFromStart(TEXT("set_"), ESearchCase::CaseSensitive))
+    {
+    method_name.Append(TEXT("_set"));
+    }
+  
+  // If name starts with "is_", "has_" or "can_" also append question mark
+  if (method_name.Find(TEXT("is_"), ESearchCase::CaseSensitive) == 0
+   || method_name.Find(TEXT("has_"), ESearchCase::CaseSensitive) == 0
+   || method_name.Find(TEXT("can_"), ESearchCase::CaseSensitive) == 0)
+    {
+    is_boolean = true;
+    }
+
+  // Append question mark if determined to be boolean
+  if (is_boolean && returns_boolean)
+    {
+    method_name += TEXT("?");
+    }
+
+  method_name_cache[returns_boolean].Add(name, method_name);
+  return method_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_skookum_class_name(UClass * class_p)
+  {
+  return skookify_class_name(class_p->GetName());
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_skookum_class_path(UClass * class_p)
+  {
+  // Remember class name
+  FString class_name = skookify_class_name(class_p->GetName());
+
+  // Make array of the super classes
+  TArray<UClass *> super_class_stack;
+  super_class_stack.Reserve(32);
+  while ((class_p = class_p->GetSuperClass()) != nullptr)
+    {
+    super_class_stack.Push(class_p);
+    m_used_classes.AddUnique(class_p); // all super classes are also considered used
+    }
+
+  // Build path
+  int32 max_super_class_nesting = FMath::Max(m_scripts_path_depth - 1, 0);
+  FString class_path = m_scripts_path / TEXT("Object");
+  for (int32 i = 0; i < max_super_class_nesting && super_class_stack.Num(); ++i)
+    {
+    class_path /= skookify_class_name(super_class_stack.Pop()->GetName());
+    }
+  if (super_class_stack.Num())
+    {
+    class_name = skookify_class_name(super_class_stack[0]->GetName()) + TEXT(".") + class_name;
+    }
+  return class_path / class_name;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_skookum_method_path(UClass * class_p, const FString & script_function_name, bool is_static)
+  {
+  return get_skookum_class_path(class_p) / (script_function_name.Replace(TEXT("?"), TEXT("-Q")) + (is_static ? TEXT("()C.sk") : TEXT("().sk")));
+  }
+
+//---------------------------------------------------------------------------------------
+
+FSkookumScriptGenerator::eSkTypeID FSkookumScriptGenerator::get_skookum_property_type(UProperty * property_p) const
+  {
+  // Check for simple types first
+  if (property_p->IsA(UIntProperty::StaticClass()))         return SkTypeID_Integer;
+  if (property_p->IsA(UFloatProperty::StaticClass()))       return SkTypeID_Real;
+  if (property_p->IsA(UStrProperty::StaticClass()))         return SkTypeID_String;
+  if (property_p->IsA(UNameProperty::StaticClass()))        return SkTypeID_Name;
+  if (property_p->IsA(UBoolProperty::StaticClass()))        return SkTypeID_Boolean;
+
+  // Any known struct?
+  if (property_p->IsA(UStructProperty::StaticClass()))
+    {
+    // Supported structs
+    static FName name_Vector2D("Vector2D");
+    static FName name_Vector("Vector");
+    static FName name_Vector4("Vector4");
+    static FName name_Quat("Quat");
+    static FName name_Rotator("Rotator");
+    static FName name_Transform("Transform");
+    static FName name_LinearColor("LinearColor");
+    static FName name_Color("Color");
+
+    UStructProperty * struct_prop_p = CastChecked<UStructProperty>(property_p);
+    const FName struct_name = struct_prop_p->Struct->GetFName();
+
+    if (struct_name == name_Vector2D)     return SkTypeID_Vector2;
+    if (struct_name == name_Vector)       return SkTypeID_Vector3;
+    if (struct_name == name_Vector4)      return SkTypeID_Vector4;
+    if (struct_name == name_Quat)         return SkTypeID_Rotation;
+    if (struct_name == name_Rotator)      return SkTypeID_RotationAngles;
+    if (struct_name == name_Transform)    return SkTypeID_Transform;
+    if (struct_name == name_Color)        return SkTypeID_Color;
+    if (struct_name == name_LinearColor)  return SkTypeID_Color;
+
+    // Any other struct gets its own generated value type class
+    if (m_generate_struct_bindings && can_export_struct(struct_prop_p->Struct)) return SkTypeID_UStruct;
+    }
+
+  if (property_p->IsA(UClassProperty::StaticClass()))       return SkTypeID_UClass;
+  if (property_p->IsA(UObjectPropertyBase::StaticClass()))  return SkTypeID_UObject;
+
+  // Arrays of any known type except arrays
+  if (property_p->IsA(UArrayProperty::StaticClass()))
+    {
+    eSkTypeID inner_type_id = get_skookum_property_type(CastChecked<UArrayProperty>(property_p)->Inner);
+    if (inner_type_id != SkTypeID_None && inner_type_id != SkTypeID_List) return SkTypeID_List;
+    }
+
+  // Didn't find a known type
+  return SkTypeID_None;
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_skookum_property_type_name(UProperty * property_p)
+  {
+  eSkTypeID type_id = get_skookum_property_type(property_p);
+  if (type_id == SkTypeID_UObject)
+    {
+    UObjectPropertyBase * object_property_p = Cast<UObjectPropertyBase>(property_p);
+    m_used_classes.AddUnique(object_property_p->PropertyClass);
+    return skookify_class_name(object_property_p->PropertyClass->GetName());
+    }
+  if (type_id == SkTypeID_UStruct)
+    {
+    UScriptStruct * struct_p = CastChecked<UStructProperty>(property_p)->Struct;
+    m_used_structs.AddUnique(struct_p);
+    return skookify_class_name(struct_p->GetName());
+    }
+  if (type_id == SkTypeID_List)
+    {
+    return FString::Printf(TEXT("List{%s}"), *get_skookum_property_type_name(CastChecked<UArrayProperty>(property_p)->Inner));
+    }
+
+  return ms_sk_type_id_names[type_id];
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_skookum_binding_class_name(UProperty * property_p)
+  {
+  eSkTypeID type_id = get_skookum_property_type(property_p);
+  if (type_id == SkTypeID_UObject || type_id == SkTypeID_UStruct)
+    {
+    return TEXT("SkUE") + get_skookum_property_type_name(property_p);
+    }
+  if (type_id == SkTypeID_List)
+    {
+    UProperty * inner_property_p = CastChecked<UArrayProperty>(property_p)->Inner;
+    return FString::Printf(TEXT("SkUEList<%s, %s>"), *get_skookum_binding_class_name(inner_property_p), *get_cpp_array_element_type_name(inner_property_p, CPPF_ArgumentOrReturnValue));
+    }
+
+  return ms_sk_type_id_binding_class_names[type_id];
+  }
+
+//---------------------------------------------------------------------------------------
+
+uint32 FSkookumScriptGenerator::get_skookum_string_crc(const FString & string)
+  {
+  // Convert the whole string - a fixed size buffer would silently truncate long names
+  FTCHARToUTF8 string_utf8(*string, string.Len());
+  return FCrc::MemCrc32(string_utf8.Get(), string_utf8.Length());
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_cpp_class_name(UClass * class_p)
+  {
+  return FString::Printf(TEXT("%s%s"), class_p->GetPrefixCPP(), *class_p->GetName());
+  }
+
+//---------------------------------------------------------------------------------------
+
+FString FSkookumScriptGenerator::get_cpp_property_type_name(UProperty * property_p, uint32 port_flags /*= 0*/)
+  {
+  static FString decl_Enum(TEXT("enum "));
+  static FString decl_Struct(TEXT("struct "));
+  static FString decl_Class(TEXT("class "));
+  static FString decl_TEnumAsByte(TEXT("TEnumAsByte<enum "));
+  static FString decl_TSubclassOf(TEXT("TSubclassOf<class "));
+  static FString decl_TSubclassOfShort(TEXT("TSubclassOf<"));
+
+  // GetCPPType() returns just "TArray" for arrays, so assemble the template ourselves
+  UArrayProperty * array_property_p = Cast<UArrayProperty>(property_p);
+  if (array_property_p)
+    {
+    return FString::Printf(TEXT("TArray<%s>"), *get_cpp_array_element_type_name(array_property_p->Inner, port_flags));
+    }
+
+  FString property_type_name = property_p->GetCPPType(NULL, port_flags);
+  // Strip any forward declaration keywords
+  if (property_type_name.StartsWith(decl_Enum) || property_type_name.StartsWith(decl_Struct) || property_type_name.StartsWith(decl_Class))
+    {
+    int first_space_index = property_type_name.Find(TEXT(" "));
+    property_type_name = property_type_name.Mid(first_space_index + 1);
+    }
+  else if (property_type_name.StartsWith(decl_TEnumAsByte))
+    {
+    int first_space_index = property_type_name.Find(TEXT(" "));
+    property_type_name = TEXT("TEnumAsByte<") + property_type_name.Mid(first_space_index + 1);
+    }
+  else if (property_type_name.StartsWith(decl_TSubclassOf)
+        || property_type_name.StartsWith(decl_TSubclassOfShort))
+    {
+    property_type_name = TEXT("UClass *");
+    }
+  return property_type_name;
+  }
 
 //---------------------------------------------------------------------------------------
 
-void FSkookumScriptGenerator::generate_master_binding_file()
+FString FSkookumScriptGenerator::get_cpp_array_element_type_name(UProperty * inner_property_p, uint32 port_flags)
   {
-  FString generated_code;
+  // A single TSubclassOf<> can be passed as UClass *, but an array of them must keep its own type
+  // The list marshaling then converts each element between UClass * and TSubclassOf<>
+  FString element_type_name = inner_property_p->GetCPPType(NULL, port_flags);
+  if (element_type_name.StartsWith(TEXT("TSubclassOf<")))
+    {
+    return element_type_name.Replace(TEXT("<class "), TEXT("<")).TrimTrailing();
+    }
+  return get_cpp_property_type_name(inner_property_p, port_flags);
+  }
 
-  generated_code += TEXT("\r\n");
+//---------------------------------------------------------------------------------------
 
-  generated_code += TEXT("#include \"SkookumScript/SkClass.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkBrain.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkInvokedMethod.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkInteger.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkReal.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkBoolean.hpp\"\r\n");
-  generated_code += TEXT("#include \"SkookumScript/SkString.hpp\"\r\n");
+void FSkookumScriptGenerator::snapshot_class(UClass * class_p, const FString & source_header_file_name)
+  {
+  FMemoryWriter ar(m_reflection_snapshot_data, false, true); // Append
+  ++m_reflection_snapshot_class_count;
+
+  snapshot_name(ar, class_p->GetName());
+  snapshot_name(ar, class_p->GetPrefixCPP());
+  snapshot_name(ar, source_header_file_name);
+  uint32 class_flags = class_p->ClassFlags;
+  uint64 cast_flags = class_p->ClassCastFlags;
+  ar << class_flags << cast_flags;
+  snapshot_meta_data(ar, class_p);
+
+  // Super chain, nearest first
+  TArray<UClass *> super_classes;
+  for (UClass * super_class_p = class_p->GetSuperClass(); super_class_p; super_class_p = super_class_p->GetSuperClass())
+    {
+    super_classes.Add(super_class_p);
+    }
+  int32 count = super_classes.Num();
+  ar << count;
+  for (auto super_class_p : super_classes)
+    {
+    snapshot_name(ar, super_class_p->GetName());
+    }
 
-  generated_code += TEXT("\r\n");
+  // Functions with their parameters
+  TArray<UFunction *> functions;
+  for (TFieldIterator<UFunction> function_it(class_p); function_it; ++function_it)
+    {
+    functions.Add(*function_it);
+    }
+  count = functions.Num();
+  ar << count;
+  for (auto function_p : functions)
+    {
+    snapshot_name(ar, function_p->GetName());
+    snapshot_name(ar, function_p->GetOwnerClass()->GetName());
+    uint32 function_flags = function_p->FunctionFlags;
+    ar << function_flags;
+    snapshot_meta_data(ar, function_p);
+    int32 param_count = 0;
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      ++param_count;
+      }
+    ar << param_count;
+    for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+      {
+      snapshot_property(ar, *param_it);
+      }
+    }
 
-  // Include all headers
-  for (auto & header_file_name : m_all_header_file_names)
+  // Properties
+  TArray<UProperty *> properties;
+  for (TFieldIterator<UProperty> property_it(class_p); property_it; ++property_it)
     {
-    // Re-base to make sure we're including the right files on a remote machine
-    FString NewFilename(FPaths::GetCleanFilename(header_file_name));
-    generated_code += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+    properties.Add(*property_it);
+    }
+  count = properties.Num();
+  ar << count;
+  for (auto property_p : properties)
+    {
+    UClass * owner_class_p = property_p->GetOwnerClass();
+    snapshot_name(ar, owner_class_p ? owner_class_p->GetName() : FString());
+    snapshot_property(ar, property_p);
     }
+  }
 
-  generated_code += TEXT("\r\n");
+//---------------------------------------------------------------------------------------
 
-  // Include all bindings
-  for (auto & binding_file_name : m_all_binding_file_names)
+void FSkookumScriptGenerator::snapshot_property(FArchive & ar, UProperty * property_p)
+  {
+  snapshot_name(ar, property_p->GetName());
+  snapshot_name(ar, property_p->GetClass()->GetName()); // E.g. FloatProperty
+  snapshot_name(ar, get_cpp_property_type_name(property_p, CPPF_ArgumentOrReturnValue));
+  uint64 property_flags = property_p->PropertyFlags;
+  int32 array_dim = property_p->ArrayDim;
+  ar << property_flags << array_dim;
+  snapshot_meta_data(ar, property_p);
+
+  // Name of the struct, enum or class referenced, if any - structs and enums get their own records
+  FString type_object_name;
+  if (UStructProperty * struct_property_p = Cast<UStructProperty>(property_p))
     {
-    // Re-base to make sure we're including the right files on a remote machine
-    FString NewFilename(FPaths::GetCleanFilename(binding_file_name));
-    generated_code += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+    type_object_name = struct_property_p->Struct->GetName();
+    m_reflection_snapshot_structs.AddUnique(struct_property_p->Struct);
+    }
+  else if (UByteProperty * byte_property_p = Cast<UByteProperty>(property_p))
+    {
+    if (byte_property_p->Enum)
+      {
+      type_object_name = byte_property_p->Enum->GetName();
+      m_reflection_snapshot_enums.AddUnique(byte_property_p->Enum);
+      }
+    }
+  else if (UClassProperty * class_property_p = Cast<UClassProperty>(property_p))
+    {
+    type_object_name = class_property_p->MetaClass->GetName();
+    }
+  else if (UObjectPropertyBase * object_property_p = Cast<UObjectPropertyBase>(property_p))
+    {
+    type_object_name = object_property_p->PropertyClass->GetName();
     }
+  snapshot_name(ar, type_object_name);
 
-  generated_code += TEXT("\r\nnamespace SkUE\r\n  {\r\n\r\n");
+  // Array element type follows its array
+  UArrayProperty * array_property_p = Cast<UArrayProperty>(property_p);
+  uint8 has_inner = array_property_p ? 1 : 0;
+  ar << has_inner;
+  if (array_property_p)
+    {
+    snapshot_property(ar, array_property_p->Inner);
+    }
+  }
 
-  generated_code += TEXT("  void register_bindings()\r\n    {\r\n");
-  for (auto class_p : m_exported_classes)
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::snapshot_struct(FArchive & ar, UScriptStruct * struct_p)
+  {
+  snapshot_name(ar, struct_p->GetName());
+  snapshot_name(ar, struct_p->GetPrefixCPP());
+  snapshot_name(ar, struct_p->GetPathName());
+  uint32 struct_flags = struct_p->StructFlags;
+  ar << struct_flags;
+  snapshot_meta_data(ar, struct_p);
+
+  TArray<UProperty *> fields;
+  for (TFieldIterator<UProperty> field_it(struct_p); field_it; ++field_it)
     {
-    generated_code += FString::Printf(TEXT("    SkUE%s::register_bindings();\r\n"), *get_skookum_class_name(class_p));
+    fields.Add(*field_it);
     }
-  generated_code += FString::Printf(TEXT("\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_u2s.Reserve(%d);\r\n"), m_exported_classes.Num());
-  for (auto class_p : m_exported_classes)
+  int32 count = fields.Num();
+  ar << count;
+  for (auto field_p : fields)
     {
-    generated_code += FString::Printf(TEXT("    SkUEClassBindingHelper::ms_class_map_u2s.Add(SkUE%s::ms_uclass_p, SkUE%s::ms_class_p);\r\n"), *get_skookum_class_name(class_p), *get_skookum_class_name(class_p));
+    snapshot_property(ar, field_p);
     }
-  generated_code += FString::Printf(TEXT("\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reset();\r\n    SkUEClassBindingHelper::ms_class_map_s2u.Reserve(%d);\r\n"), m_exported_classes.Num());
-  for (auto class_p : m_exported_classes)
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::snapshot_enum(FArchive & ar, UEnum * enum_p)
+  {
+  snapshot_name(ar, enum_p->GetName());
+  snapshot_name(ar, enum_p->CppType);
+  snapshot_meta_data(ar, enum_p);
+
+  // Values are implied by their position
+  int32 count = enum_p->NumEnums();
+  ar << count;
+  for (int32 i = 0; i < count; ++i)
     {
-    generated_code += FString::Printf(TEXT("    SkUEClassBindingHelper::ms_class_map_s2u.Add(SkUE%s::ms_class_p, SkUE%s::ms_uclass_p);\r\n"), *get_skookum_class_name(class_p), *get_skookum_class_name(class_p));
+    snapshot_name(ar, enum_p->GetEnumName(i));
     }
-  generated_code += TEXT("\r\n    }\r\n");
+  }
 
-  generated_code += TEXT("\r\n  } // SkUE\r\n");
+//---------------------------------------------------------------------------------------
 
-  FString master_binding_file_name = m_binding_code_path / TEXT("SkUE.generated.inl");
-  save_header_if_changed(master_binding_file_name, generated_code);
+void FSkookumScriptGenerator::snapshot_meta_data(FArchive & ar, UField * field_p)
+  {
+  TArray<const TCHAR *> keys;
+  for (auto key_p : ms_snapshot_meta_data_keys)
+    {
+    if (field_p->HasMetaData(key_p))
+      {
+      keys.Add(key_p);
+      }
+    }
+  int32 count = keys.Num();
+  ar << count;
+  for (auto key_p : keys)
+    {
+    snapshot_name(ar, key_p);
+    snapshot_name(ar, field_p->GetMetaData(key_p));
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-bool FSkookumScriptGenerator::can_export_class(UClass * class_p, const FString & source_header_file_name) const
+void FSkookumScriptGenerator::snapshot_name(FArchive & ar, const FString & name)
   {
-  FString class_name = *class_p->GetName();
+  int32 * index_p = m_reflection_snapshot_name_indices.Find(name);
+  int32 index = index_p ? *index_p : m_reflection_snapshot_name_indices.Add(name, m_reflection_snapshot_names.Add(name));
+  ar << index;
+  }
 
-  return does_class_have_static_class(class_p) // Don't export classes that don't export DLL symbols
-    && !m_exported_classes.Contains(class_p) // Don't export classes that have already been exported
-    && !m_skip_classes.Contains(class_name); // Don't export classes that set to skip in UHT config file
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::save_reflection_snapshot()
+  {
+  // Layout, all little endian:
+  //   uint32 'SKRS', uint32 version
+  //   int32 name count, then per name: int32 byte length + UTF-8 bytes
+  //   int32 class count, then the class records as written by snapshot_class() - names are indices into the table above
+  //   int32 struct count, then the struct records as written by snapshot_struct()
+  //   int32 enum count, then the enum records as written by snapshot_enum()
+  // Meta data is written as int32 count + key/value name pairs right after the flags of a record
+
+  // Struct and enum records go first as they add to the string table - fields may reference further structs
+  TArray<uint8> type_data;
+  FMemoryWriter type_ar(type_data);
+  TArray<uint8> struct_data;
+  FMemoryWriter struct_ar(struct_data);
+  for (int32 struct_index = 0; struct_index < m_reflection_snapshot_structs.Num(); ++struct_index)
+    {
+    snapshot_struct(struct_ar, m_reflection_snapshot_structs[struct_index]);
+    }
+  int32 struct_count = m_reflection_snapshot_structs.Num();
+  type_ar << struct_count;
+  type_ar.Serialize(struct_data.GetData(), struct_data.Num());
+  int32 enum_count = m_reflection_snapshot_enums.Num();
+  type_ar << enum_count;
+  for (auto enum_p : m_reflection_snapshot_enums)
+    {
+    snapshot_enum(type_ar, enum_p);
+    }
+
+  TArray<uint8> file_data;
+  FMemoryWriter ar(file_data);
+
+  uint32 magic = 0x53524b53; // 'SKRS'
+  uint32 version = 2;
+  ar << magic << version;
+
+  int32 name_count = m_reflection_snapshot_names.Num();
+  ar << name_count;
+  for (auto & name : m_reflection_snapshot_names)
+    {
+    FTCHARToUTF8 name_utf8(*name);
+    int32 length = name_utf8.Length();
+    ar << length;
+    ar.Serialize((void *)name_utf8.Get(), length);
+    }
+
+  ar << m_reflection_snapshot_class_count;
+  ar.Serialize(m_reflection_snapshot_data.GetData(), m_reflection_snapshot_data.Num());
+  ar.Serialize(type_data.GetData(), type_data.Num());
+
+  FString snapshot_file_path = m_binding_code_path / get_shard_file_name(TEXT("SkUEReflection.snapshot"));
+  if (!FFileHelper::SaveArrayToFile(file_data, *snapshot_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *snapshot_file_path);
+    }
+
+  // Round trip so a layout change that the writer and reader disagree on fails here and not in the offline tools
+  verify_reflection_snapshot(snapshot_file_path);
   }
 
 //---------------------------------------------------------------------------------------
 
-bool FSkookumScriptGenerator::can_export_method(UClass * class_p, UFunction * function_p)
+void FSkookumScriptGenerator::verify_reflection_snapshot(const FString & file_path)
   {
-  // If this function is inherited, do nothing as SkookumScript will inherit it for us
-  if (function_p->GetOwnerClass() != class_p)
-    return false;
+  TArray<uint8> file_data;
+  if (!FFileHelper::LoadFileToArray(file_data, *file_path))
+    {
+    FError::Throwf(TEXT("Could not load reflection snapshot: %s"), *file_path);
+    }
+  FMemoryReader ar(file_data);
 
-  // We don't support delegates and non-public functions
-  if ((function_p->FunctionFlags & FUNC_Delegate))
+  uint32 magic, version;
+  ar << magic << version;
+  if (magic != 0x53524b53 || version != 2)
     {
-    return false;
+    FError::Throwf(TEXT("Unknown reflection snapshot format: %s"), *file_path);
     }
 
-  // Reject if any of the parameter types is unsupported yet
-  for (TFieldIterator<UProperty> param_it(function_p); param_it; ++param_it)
+  int32 name_count;
+  ar << name_count;
+  TArray<FString> names;
+  TArray<ANSICHAR> name_utf8;
+  for (int32 i = 0; i < name_count && !ar.IsError(); ++i)
     {
-    UProperty * param_p = *param_it;
+    int32 length;
+    ar << length;
+    if (length < 0 || length > ar.TotalSize() - ar.Tell())
+      {
+      FError::Throwf(TEXT("Corrupt string table in reflection snapshot: %s"), *file_path);
+      }
+    name_utf8.SetNumUninitialized(length + 1);
+    ar.Serialize(name_utf8.GetData(), length);
+    name_utf8[length] = 0;
+    names.Add(UTF8_TO_TCHAR(name_utf8.GetData()));
+    }
+  if (names != m_reflection_snapshot_names)
+    {
+    FError::Throwf(TEXT("String table of reflection snapshot %s does not match the one written."), *file_path);
+    }
 
-    if (param_p->IsA(UArrayProperty::StaticClass()) ||
-      param_p->ArrayDim > 1 ||
-      param_p->IsA(UDelegateProperty::StaticClass()) ||
-      param_p->IsA(UMulticastDelegateProperty::StaticClass()) ||
-      param_p->IsA(UWeakObjectProperty::StaticClass()) ||
-      param_p->IsA(UInterfaceProperty::StaticClass()))
+  // Classes
+  int32 class_count;
+  ar << class_count;
+  for (int32 class_index = 0; class_index < class_count && !ar.IsError(); ++class_index)
+    {
+    read_snapshot_name(ar, names); // Name
+    read_snapshot_name(ar, names); // C++ prefix
+    read_snapshot_name(ar, names); // Source header
+    uint32 class_flags;
+    uint64 cast_flags;
+    ar << class_flags << cast_flags;
+    read_snapshot_meta_data(ar, names);
+    int32 count;
+    ar << count;
+    for (int32 i = 0; i < count && !ar.IsError(); ++i)
       {
-      return false;
+      read_snapshot_name(ar, names); // Super class
       }
+    ar << count;
+    for (int32 i = 0; i < count && !ar.IsError(); ++i)
+      {
+      read_snapshot_name(ar, names); // Function name
+      read_snapshot_name(ar, names); // Owner class
+      uint32 function_flags;
+      ar << function_flags;
+      read_snapshot_meta_data(ar, names);
+      int32 param_count;
+      ar << param_count;
+      for (int32 param_index = 0; param_index < param_count && !ar.IsError(); ++param_index)
+        {
+        read_snapshot_property(ar, names);
+        }
+      }
+    ar << count;
+    for (int32 i = 0; i < count && !ar.IsError(); ++i)
+      {
+      read_snapshot_name(ar, names); // Owner class
+      read_snapshot_property(ar, names);
+      }
+    }
 
-    if (!is_property_type_supported(param_p))
+  // Structs
+  int32 struct_count;
+  ar << struct_count;
+  for (int32 struct_index = 0; struct_index < struct_count && !ar.IsError(); ++struct_index)
+    {
+    read_snapshot_name(ar, names); // Name
+    read_snapshot_name(ar, names); // C++ prefix
+    read_snapshot_name(ar, names); // Path name
+    uint32 struct_flags;
+    ar << struct_flags;
+    read_snapshot_meta_data(ar, names);
+    int32 count;
+    ar << count;
+    for (int32 i = 0; i < count && !ar.IsError(); ++i)
       {
-      return false;
+      read_snapshot_property(ar, names);
       }
     }
 
-  return true;
+  // Enums
+  int32 enum_count;
+  ar << enum_count;
+  for (int32 enum_index = 0; enum_index < enum_count && !ar.IsError(); ++enum_index)
+    {
+    read_snapshot_name(ar, names); // Name
+    read_snapshot_name(ar, names); // C++ type
+    read_snapshot_meta_data(ar, names);
+    int32 count;
+    ar << count;
+    for (int32 i = 0; i < count && !ar.IsError(); ++i)
+      {
+      read_snapshot_name(ar, names); // Value name
+      }
+    }
+
+  if (ar.IsError() || ar.Tell() != ar.TotalSize()
+    || class_count != m_reflection_snapshot_class_count
+    || struct_count != m_reflection_snapshot_structs.Num()
+    || enum_count != m_reflection_snapshot_enums.Num())
+    {
+    FError::Throwf(TEXT("Reflection snapshot %s does not read back as written."), *file_path);
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-bool FSkookumScriptGenerator::can_export_property(UClass * class_p, UProperty * property_p)
+FString FSkookumScriptGenerator::read_snapshot_name(FArchive & ar, const TArray<FString> & names)
   {
-  // If this property is inherited, do nothing as SkookumScript will inherit it for us
-  if (property_p->GetOwnerClass() != class_p)
-    return false;
+  int32 index = -1;
+  ar << index;
+  if (!names.IsValidIndex(index))
+    {
+    FError::Throwf(TEXT("Reflection snapshot name index %d out of range."), index);
+    }
+  return names[index];
+  }
 
-  // Check if property type is supported
-  return is_property_type_supported(property_p);
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::read_snapshot_meta_data(FArchive & ar, const TArray<FString> & names)
+  {
+  int32 count;
+  ar << count;
+  for (int32 i = 0; i < count && !ar.IsError(); ++i)
+    {
+    read_snapshot_name(ar, names); // Key
+    read_snapshot_name(ar, names); // Value
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-bool FSkookumScriptGenerator::does_class_have_static_class(UClass * class_p)
+void FSkookumScriptGenerator::read_snapshot_property(FArchive & ar, const TArray<FString> & names)
   {
-  return !!(class_p->ClassFlags & (CLASS_RequiredAPI | CLASS_MinimalAPI));
+  read_snapshot_name(ar, names); // Name
+  read_snapshot_name(ar, names); // Property class
+  read_snapshot_name(ar, names); // C++ type
+  uint64 property_flags;
+  int32 array_dim;
+  ar << property_flags << array_dim;
+  read_snapshot_meta_data(ar, names);
+  read_snapshot_name(ar, names); // Referenced struct, enum or class
+  uint8 has_inner;
+  ar << has_inner;
+  if (has_inner)
+    {
+    read_snapshot_property(ar, names);
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-bool FSkookumScriptGenerator::is_property_type_supported(UProperty * property_p)
+void FSkookumScriptGenerator::add_signature(const FString & file_path, const FString & text)
   {
-  if (property_p->IsA(ULazyObjectProperty::StaticClass())
-    || property_p->IsA(UAssetObjectProperty::StaticClass())
-    || property_p->IsA(UAssetClassProperty::StaticClass())
-    || property_p->IsA(UWeakObjectProperty::StaticClass()))
+  // Class path relative to the overlay and file name (= member name and kind) as the compiler would derive them from the file
+  FString scripts_path(m_scripts_path / TEXT(""));
+  FPaths::NormalizeFilename(scripts_path);
+  FString relative_path(file_path);
+  FPaths::MakePathRelativeTo(relative_path, *scripts_path);
+
+  FString class_path = FPaths::GetPath(relative_path);
+  FString file_name = FPaths::GetCleanFilename(relative_path);
+
+  // A file saved more than once in a run still is one script file to the compiler
+  bool is_already_recorded = false;
+  m_signature_file_paths.Add(class_path / file_name, &is_already_recorded);
+  if (is_already_recorded)
     {
-    return false;
+    return;
     }
 
-  return (get_skookum_property_type(property_p) != SkTypeID_None);
+  FMemoryWriter ar(m_signature_data, false, true); // Append
+  ++m_signature_count;
+  signature_name(ar, class_path);
+  signature_name(ar, file_name);
+
+  // Tokens of the signature - identifiers and single punctuation characters, whitespace dropped
+  TArray<FString> tokens;
+  const TCHAR * char_p = *text;
+  while (*char_p)
+    {
+    if (FChar::IsWhitespace(*char_p))
+      {
+      ++char_p;
+      }
+    else if (FCString::Strchr(TEXT("(),;{}:"), *char_p))
+      {
+      tokens.Add(FString(1, char_p++));
+      }
+    else
+      {
+      const TCHAR * begin_p = char_p;
+      while (*char_p && !FChar::IsWhitespace(*char_p) && !FCString::Strchr(TEXT("(),;{}:"), *char_p))
+        {
+        ++char_p;
+        }
+      tokens.Add(FString(char_p - begin_p, begin_p));
+      }
+    }
+  int32 count = tokens.Num();
+  ar << count;
+  for (auto & token : tokens)
+    {
+    signature_name(ar, token);
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::skookify_class_name(const FString & name)
+void FSkookumScriptGenerator::signature_name(FArchive & ar, const FString & name)
   {
-  if (name == TEXT("Object")) return TEXT("Entity");
-  if (name == TEXT("Class"))  return TEXT("EntityClass");
-  if (name == TEXT("Enum"))   return TEXT("Enum2"); // HACK
-
-  return name;
+  int32 * index_p = m_signature_name_indices.Find(name);
+  int32 index = index_p ? *index_p : m_signature_name_indices.Add(name, m_signature_names.Add(name));
+  ar << index;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::skookify_var_name(const FString & name, bool * is_boolean_p)
+void FSkookumScriptGenerator::load_signature_database(const FString & file_path)
   {
-  if (name.IsEmpty()) return name;
+  TArray<uint8> file_data;
+  if (!FFileHelper::LoadFileToArray(file_data, *file_path))
+    {
+    FError::Throwf(TEXT("Could not load signature database: %s"), *file_path);
+    }
+  FMemoryReader ar(file_data);
 
-  // Change title case to lower case with underscores
-  FString skookum_name;
-  skookum_name.Reserve(name.Len() + 16);
-  bool is_boolean = name[0] == 'b' && isupper(name[1]);
-  bool was_upper = true;
-  bool was_underscore = true;
-  for (int32 i = int32(is_boolean); i < name.Len(); ++i)
+  uint32 magic, version;
+  ar << magic << version;
+  if (magic != 0x47534b53 || version != 1)
     {
-    TCHAR c = name[i];
-    bool is_upper = isupper(c) != 0 || isdigit(c) != 0;
-    if (is_upper && !was_upper && !was_underscore)
+    FError::Throwf(TEXT("Unknown signature database format: %s"), *file_path);
+    }
+
+  int32 name_count;
+  ar << name_count;
+  TArray<FString> names;
+  TArray<ANSICHAR> name_utf8;
+  for (int32 i = 0; i < name_count && !ar.IsError(); ++i)
+    {
+    int32 length;
+    ar << length;
+    if (length < 0 || length > ar.TotalSize() - ar.Tell())
       {
-      skookum_name.AppendChar('_');
+      FError::Throwf(TEXT("Corrupt string table in signature database: %s"), *file_path);
       }
-    skookum_name.AppendChar(tolower(c));
-    was_upper = is_upper;
-    was_underscore = (c == TCHAR('_'));
+    name_utf8.SetNumUninitialized(length + 1);
+    ar.Serialize(name_utf8.GetData(), length);
+    name_utf8[length] = 0;
+    names.Add(UTF8_TO_TCHAR(name_utf8.GetData()));
+    }
+
+  auto read_name = [&ar, &names, &file_path]() -> const FString &
+    {
+    int32 index = -1;
+    ar << index;
+    if (!names.IsValidIndex(index))
+      {
+      FError::Throwf(TEXT("Signature database %s has name index %d out of range."), *file_path, index);
+      }
+    return names[index];
+    };
+
+  // Re-index the records into our string table, skipping script files another shard has recorded already
+  int32 record_count;
+  ar << record_count;
+  FMemoryWriter writer(m_signature_data, false, true); // Append
+  TArray<FString> tokens;
+  for (int32 record = 0; record < record_count && !ar.IsError(); ++record)
+    {
+    FString class_path = read_name();
+    FString file_name = read_name();
+    int32 count;
+    ar << count;
+    if (count < 0 || count > (ar.TotalSize() - ar.Tell()) / (int64)sizeof(int32))
+      {
+      FError::Throwf(TEXT("Corrupt record in signature database: %s"), *file_path);
+      }
+    tokens.Reset();
+    for (int32 i = 0; i < count; ++i)
+      {
+      tokens.Add(read_name());
+      }
+
+    bool is_already_recorded = false;
+    m_signature_file_paths.Add(class_path / file_name, &is_already_recorded);
+    if (is_already_recorded)
+      {
+      continue;
+      }
+    signature_name(writer, class_path);
+    signature_name(writer, file_name);
+    writer << count;
+    for (auto & token : tokens)
+      {
+      signature_name(writer, token);
+      }
+    ++m_signature_count;
+    }
+
+  if (ar.IsError() || record_count < 0 || ar.Tell() != ar.TotalSize())
+    {
+    FError::Throwf(TEXT("Signature database %s is truncated or corrupt."), *file_path);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::save_signature_database()
+  {
+  // Layout, all little endian:
+  //   uint32 'SKSG', uint32 version
+  //   int32 name count, then per name: int32 byte length + UTF-8 bytes
+  //   int32 record count, then per script file: int32 class path, int32 file name, int32 token count, int32 tokens - all indices into the table above
+  TArray<uint8> file_data;
+  FMemoryWriter ar(file_data);
+
+  uint32 magic = 0x47534b53; // 'SKSG'
+  uint32 version = 1;
+  ar << magic << version;
+
+  int32 name_count = m_signature_names.Num();
+  ar << name_count;
+  for (auto & name : m_signature_names)
+    {
+    FTCHARToUTF8 name_utf8(*name);
+    int32 length = name_utf8.Length();
+    ar << length;
+    ar.Serialize((void *)name_utf8.Get(), length);
+    }
+
+  ar << m_signature_count;
+  ar.Serialize(m_signature_data.GetData(), m_signature_data.Num());
+
+  // A shard's database is only input to the merge step, so keep it with the other shard files rather than among the scripts
+  FString database_file_path = (m_shard_index >= 0 ? m_binding_code_path : m_scripts_path) / get_shard_file_name(TEXT("Signatures.sk-db"));
+  uint32 crc;
+  if (has_file_changed(database_file_path, (const ANSICHAR *)file_data.GetData(), file_data.Num(), &crc)
+   && !save_utf8_file((const ANSICHAR *)file_data.GetData(), file_data.Num(), database_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *database_file_path);
+    }
+  record_file_hash(database_file_path, crc, file_data.Num());
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGenerator::save_text_file(const FString & text, const FString & file_path)
+  {
+  FArchive * file_p = IFileManager::Get().CreateFileWriter(*file_path);
+  if (!file_p)
+    {
+    return false;
     }
 
-  // Check for reserved keywords and append underscore if found
-  for (uint32 i = 0; i < sizeof(ms_reserved_keywords) / sizeof(ms_reserved_keywords[0]); ++i)
+  // Convert and write in chunks so no UTF-8 copy of the whole text is ever held - no encoding detection scan and no BOM
+  const int32 chunk_length = 16 * 1024;
+  const TCHAR * text_p = *text;
+  const int32 text_length = text.Len();
+  for (int32 offset = 0; offset < text_length;)
     {
-    if (skookum_name == ms_reserved_keywords[i])
+    int32 length = FMath::Min(chunk_length, text_length - offset);
+    // Keep surrogate pairs together
+    const uint32 last_char = uint32(text_p[offset + length - 1]);
+    if (offset + length < text_length && last_char >= 0xd800u && last_char <= 0xdbffu)
       {
-      skookum_name.AppendChar('_');
-      break;
+      --length;
       }
+    FTCHARToUTF8 chunk_utf8(text_p + offset, length);
+    file_p->Serialize((void *)chunk_utf8.Get(), chunk_utf8.Length());
+    offset += length;
     }
 
-  if (is_boolean_p) *is_boolean_p = is_boolean;
-  return skookum_name;
+  bool success = file_p->Close();
+  delete file_p;
+  return success;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::skookify_method_name(const FString & name, UProperty * return_property_p)
+bool FSkookumScriptGenerator::save_utf8_file(const ANSICHAR * text_p, int32 length, const FString & file_path)
   {
-  bool is_boolean = false;
-  FString method_name = skookify_var_name(name, &is_boolean);
+  FArchive * file_p = IFileManager::Get().CreateFileWriter(*file_path);
+  if (!file_p)
+    {
+    return false;
+    }
+  file_p->Serialize((void *)text_p, length);
+  bool success = file_p->Close();
+  delete file_p;
+  return success;
+  }
 
-  // Remove K2 (Kismet 2) prefix if present
-  method_name.RemoveFromStart(TEXT("k2_"), ESearchCase::CaseSensitive);
+//---------------------------------------------------------------------------------------
 
-  // If name starts with "get_", remove it
-  if (method_name.RemoveFromStart(TEXT("get_"), ESearchCase::CaseSensitive))
+bool FSkookumScriptGenerator::is_file_equal(const FString & file_path, const ANSICHAR * text_p, int32 length)
+  {
+  // Different size means different contents - no need to open the file at all
+  if (IFileManager::Get().FileSize(*file_path) != length)
     {
-    // Append question mark
-    is_boolean = true;
+    return false;
     }
-  // If name starts with "set_", remove it and append "_set" instead
-  else if (method_name.RemoveFromStart(TEXT("set_"), ESearchCase::CaseSensitive))
+
+  FArchive * file_p = IFileManager::Get().CreateFileReader(*file_path);
+  if (!file_p)
     {
-    method_name.Append(TEXT("_set"));
+    return false;
     }
-  
-  // If name starts with "is_", "has_" or "can_" also append question mark
-  if (method_name.Find(TEXT("is_"), ESearchCase::CaseSensitive) == 0
-   || method_name.Find(TEXT("has_"), ESearchCase::CaseSensitive) == 0
-   || method_name.Find(TEXT("can_"), ESearchCase::CaseSensitive) == 0)
+
+  // Compare chunk by chunk so a difference near the start doesn't cost reading the rest
+  const int32 chunk_size = 64 * 1024;
+  TArray<uint8> chunk;
+  chunk.SetNumUninitialized(FMath::Min(chunk_size, length));
+  bool is_equal = true;
+  for (int32 offset = 0; is_equal && offset < length; offset += chunk_size)
     {
-    is_boolean = true;
+    int32 bytes = FMath::Min(chunk_size, length - offset);
+    file_p->Serialize(chunk.GetData(), bytes);
+    is_equal = !file_p->IsError() && FMemory::Memcmp(chunk.GetData(), text_p + offset, bytes) == 0;
     }
+  delete file_p;
+  return is_equal;
+  }
 
-  // Append question mark if determined to be boolean
-  if (is_boolean && return_property_p && return_property_p->IsA(UBoolProperty::StaticClass()))
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::load_file_hashes()
+  {
+  // One line per file: crc size time_stamp_ticks path
+  m_file_hashes.Reset();
+  m_hashed_file_paths.Reset();
+  TArray<FString> lines;
+  if (FFileHelper::LoadANSITextFileToStrings(*(m_binding_code_path / get_shard_file_name(TEXT("SkUEGenerated.hashes"))), nullptr, lines))
     {
-    method_name += TEXT("?");
+    for (auto & line : lines)
+      {
+      TArray<FString> fields;
+      if (line.ParseIntoArray(fields, TEXT(" "), true) >= 4)
+        {
+        FileHash hash;
+        hash.m_crc = uint32(FCString::Strtoui64(*fields[0], nullptr, 16));
+        hash.m_size = FCString::Atoi64(*fields[1]);
+        hash.m_time_stamp = FDateTime(FCString::Atoi64(*fields[2]));
+        m_file_hashes.Add(line.Mid(fields[0].Len() + fields[1].Len() + fields[2].Len() + 3), hash); // Path may contain spaces
+        }
+      }
     }
+  }
 
-  return method_name;
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::save_file_hashes()
+  {
+  // Files have been moved into place by now, so their time stamps are final
+  // Only files generated in this run are kept so hashes of deleted files don't pile up
+  FString text;
+  for (auto & file_path : m_hashed_file_paths)
+    {
+    FileHash & file_hash = m_file_hashes[file_path];
+    file_hash.m_time_stamp = IFileManager::Get().GetTimeStamp(*file_path);
+    text += FString::Printf(TEXT("%08x %lld %lld %s\n"), file_hash.m_crc, file_hash.m_size, file_hash.m_time_stamp.GetTicks(), *file_path);
+    }
+  save_text_file(text, m_binding_code_path / get_shard_file_name(TEXT("SkUEGenerated.hashes")));
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::get_skookum_class_name(UClass * class_p)
+bool FSkookumScriptGenerator::is_class_in_shard(UClass * class_p) const
   {
-  return skookify_class_name(class_p->GetName());
+  // Hash the name rather than going by order of appearance so all processes agree no matter how UHT orders its classes
+  return m_shard_index >= 0 && int32(FCrc::StrCrc32(*class_p->GetName()) % uint32(m_shard_count)) == m_shard_index;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::get_skookum_class_path(UClass * class_p)
+FString FSkookumScriptGenerator::get_shard_file_name(const FString & file_name) const
   {
-  // Remember class name
-  FString class_name = skookify_class_name(class_p->GetName());
+  return m_shard_index >= 0 ? FString::Printf(TEXT("%s.shard%d.%s"), *FPaths::GetBaseFilename(file_name), m_shard_index, *FPaths::GetExtension(file_name)) : file_name;
+  }
 
-  // Make array of the super classes
-  TArray<UClass *> super_class_stack;
-  super_class_stack.Reserve(32);
-  while ((class_p = class_p->GetSuperClass()) != nullptr)
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::save_shard_manifest()
+  {
+  // One entry per line: kind name
+  FString text;
+  for (auto & header_file_name : m_all_header_file_names)
     {
-    super_class_stack.Push(class_p);
-    m_used_classes.AddUnique(class_p); // all super classes are also considered used
+    text += FString::Printf(TEXT("Header %s\n"), *header_file_name);
     }
-
-  // Build path
-  int32 max_super_class_nesting = FMath::Max(m_scripts_path_depth - 1, 0);
-  FString class_path = m_scripts_path / TEXT("Object");
-  for (int32 i = 0; i < max_super_class_nesting && super_class_stack.Num(); ++i)
+  for (auto & binding_file_name : m_all_binding_file_names)
     {
-    class_path /= skookify_class_name(super_class_stack.Pop()->GetName());
+    text += FString::Printf(TEXT("Binding %s\n"), *binding_file_name);
     }
-  if (super_class_stack.Num())
+  for (auto class_p : m_exported_classes)
     {
-    class_name = skookify_class_name(super_class_stack[0]->GetName()) + TEXT(".") + class_name;
+    text += FString::Printf(TEXT("Class %s\n"), *class_p->GetPathName());
+    }
+  for (auto class_p : m_used_classes)
+    {
+    text += FString::Printf(TEXT("UsedClass %s\n"), *class_p->GetPathName());
+    }
+  for (auto struct_p : m_used_structs)
+    {
+    text += FString::Printf(TEXT("UsedStruct %s\n"), *struct_p->GetPathName());
+    }
+  for (auto & script_file_path : m_script_file_paths)
+    {
+    text += FString::Printf(TEXT("Script %s\n"), *script_file_path);
+    }
+  if (m_has_coroutines)
+    {
+    text += TEXT("HasCoroutines\n");
+    }
+  // The code of these is concatenated in the .coroutines file - the merge step splits it by length and drops those also bound by other shards
+  for (int32 i = 0; i < m_entity_coroutine_bindings.Num(); ++i)
+    {
+    text += FString::Printf(TEXT("Coroutine %s %s %d\n"), *m_entity_coroutine_bindings[i].m_script_name, *m_entity_coroutine_bindings[i].m_code_name, m_entity_coroutine_code_lengths[i]);
     }
-  return class_path / class_name;
-  }
 
-//---------------------------------------------------------------------------------------
+  FString manifest_file_path = m_binding_code_path / get_shard_file_name(TEXT("SkUEShard.manifest"));
+  if (!save_text_file(text, manifest_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *manifest_file_path);
+    }
 
-FString FSkookumScriptGenerator::get_skookum_method_path(UClass * class_p, const FString & script_function_name, bool is_static)
-  {
-  return get_skookum_class_path(class_p) / (script_function_name.Replace(TEXT("?"), TEXT("-Q")) + (is_static ? TEXT("()C.sk") : TEXT("().sk")));
+  // Coroutines bound to Entity go into a single file, so hand their code over as well
+  FString coroutines_file_path = m_binding_code_path / get_shard_file_name(TEXT("SkUEShard.coroutines"));
+  if (!save_text_file(m_entity_coroutine_code, coroutines_file_path))
+    {
+    FError::Throwf(TEXT("Could not save file: %s"), *coroutines_file_path);
+    }
   }
 
 //---------------------------------------------------------------------------------------
 
-FSkookumScriptGenerator::eSkTypeID FSkookumScriptGenerator::get_skookum_property_type(UProperty * property_p)
+void FSkookumScriptGenerator::load_shard_manifests()
   {
-  // Check for simple types first
-  if (property_p->IsA(UIntProperty::StaticClass()))         return SkTypeID_Integer;
-  if (property_p->IsA(UFloatProperty::StaticClass()))       return SkTypeID_Real;
-  if (property_p->IsA(UStrProperty::StaticClass()))         return SkTypeID_String;
-  if (property_p->IsA(UNameProperty::StaticClass()))        return SkTypeID_Name;
-  if (property_p->IsA(UBoolProperty::StaticClass()))        return SkTypeID_Boolean;
-
-  // Any known struct?
-  if (property_p->IsA(UStructProperty::StaticClass()))
+  // Go by shard index so the merged result does not depend on which shard finished first
+  for (int32 shard_index = 0; shard_index < m_shard_count; ++shard_index)
     {
-    // Supported structs
-    static FName name_Vector2D("Vector2D");
-    static FName name_Vector("Vector");
-    static FName name_Vector4("Vector4");
-    static FName name_Quat("Quat");
-    static FName name_Rotator("Rotator");
-    static FName name_Transform("Transform");
-    static FName name_LinearColor("LinearColor");
-    static FName name_Color("Color");
-
-    UStructProperty * struct_prop_p = CastChecked<UStructProperty>(property_p);
-    const FName struct_name = struct_prop_p->Struct->GetFName();
+    FString manifest_file_path = m_binding_code_path / FString::Printf(TEXT("SkUEShard.shard%d.manifest"), shard_index);
+    TArray<FString> lines;
+    if (!FFileHelper::LoadANSITextFileToStrings(*manifest_file_path, nullptr, lines))
+      {
+      FError::Throwf(TEXT("Could not load shard manifest: %s"), *manifest_file_path);
+      }
+    TArray<MethodBinding> coroutine_bindings;
+    TArray<int32> coroutine_code_lengths;
+    for (auto & line : lines)
+      {
+      FString kind, name;
+      if (!line.Split(TEXT(" "), &kind, &name))
+        {
+        kind = line;
+        }
+      if (kind == TEXT("Header"))
+        {
+        m_all_header_file_names.AddUnique(name);
+        }
+      else if (kind == TEXT("Binding"))
+        {
+        m_all_binding_file_names.AddUnique(name);
+        }
+      else if (kind == TEXT("Class") || kind == TEXT("UsedClass"))
+        {
+        UClass * class_p = FindObject<UClass>(nullptr, *name);
+        if (!class_p)
+          {
+          FError::Throwf(TEXT("Class %s from shard manifest %s not found."), *name, *manifest_file_path);
+          }
+        if (kind == TEXT("Class"))
+          {
+          m_exported_classes.Add(class_p);
+          }
+        else
+          {
+          m_used_classes.AddUnique(class_p);
+          }
+        }
+      else if (kind == TEXT("UsedStruct"))
+        {
+        UScriptStruct * struct_p = FindObject<UScriptStruct>(nullptr, *name);
+        if (!struct_p)
+          {
+          FError::Throwf(TEXT("Struct %s from shard manifest %s not found."), *name, *manifest_file_path);
+          }
+        m_used_structs.AddUnique(struct_p);
+        }
+      else if (kind == TEXT("Script"))
+        {
+        m_script_file_paths.Add(name);
+        }
+      else if (kind == TEXT("HasCoroutines"))
+        {
+        m_has_coroutines = true;
+        }
+      else if (kind == TEXT("Coroutine"))
+        {
+        TArray<FString> fields;
+        if (name.ParseIntoArray(fields, TEXT(" "), true) != 3)
+          {
+          FError::Throwf(TEXT("Malformed coroutine entry '%s' in shard manifest %s."), *name, *manifest_file_path);
+          }
+        MethodBinding binding;
+        binding.m_script_name = fields[0];
+        binding.m_code_name = fields[1];
+        binding.m_descriptor_index = -1;
+        coroutine_bindings.Push(binding);
+        coroutine_code_lengths.Add(FCString::Atoi(*fields[2]));
+        }
+      }
 
-    if (struct_name == name_Vector2D)     return SkTypeID_Vector2;
-    if (struct_name == name_Vector)       return SkTypeID_Vector3;
-    if (struct_name == name_Vector4)      return SkTypeID_Vector4;
-    if (struct_name == name_Quat)         return SkTypeID_Rotation;
-    if (struct_name == name_Rotator)      return SkTypeID_RotationAngles;
-    if (struct_name == name_Transform)    return SkTypeID_Transform;
-    if (struct_name == name_Color)        return SkTypeID_Color;
-    if (struct_name == name_LinearColor)  return SkTypeID_Color;
+    if (m_write_signature_database)
+      {
+      load_signature_database(m_binding_code_path / FString::Printf(TEXT("Signatures.shard%d.sk-db"), shard_index));
+      }
 
+    FString coroutines_file_path = m_binding_code_path / FString::Printf(TEXT("SkUEShard.shard%d.coroutines"), shard_index);
+    FString coroutine_code;
+    if (!FFileHelper::LoadFileToString(coroutine_code, *coroutines_file_path))
+      {
+      FError::Throwf(TEXT("Could not load shard coroutines: %s"), *coroutines_file_path);
+      }
+    int32 offset = 0;
+    for (int32 i = 0; i < coroutine_bindings.Num(); ++i)
+      {
+      const int32 length = coroutine_code_lengths[i];
+      if (length < 0 || offset + length > coroutine_code.Len())
+        {
+        break;
+        }
+      if (m_entity_coroutine_bindings.Find(coroutine_bindings[i]) < 0)
+        {
+        m_entity_coroutine_code += coroutine_code.Mid(offset, length);
+        m_entity_coroutine_bindings.Push(coroutine_bindings[i]);
+        m_entity_coroutine_code_lengths.Add(length);
+        }
+      offset += length;
+      }
+    if (offset != coroutine_code.Len())
+      {
+      FError::Throwf(TEXT("Shard coroutines %s do not match the lengths in %s."), *coroutines_file_path, *manifest_file_path);
+      }
     }
-
-  if (property_p->IsA(UClassProperty::StaticClass()))       return SkTypeID_UClass;
-  if (property_p->IsA(UObjectPropertyBase::StaticClass()))  return SkTypeID_UObject;
-
-  // Didn't find a known type
-  return SkTypeID_None;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::get_skookum_property_type_name(UProperty * property_p)
+bool FSkookumScriptGenerator::has_file_changed(const FString & file_path, const ANSICHAR * text_p, int32 length, uint32 * crc_p)
   {
-  eSkTypeID type_id = get_skookum_property_type(property_p);
-  if (type_id == SkTypeID_UObject)
+  const uint32 new_crc = FCrc::MemCrc32(text_p, length);
+  *crc_p = new_crc;
+
+  // If the file is untouched since we last wrote it, its hash tells all without reading it
+  bool has_changed;
+  FileHash * file_hash_p = m_file_hashes.Find(file_path);
+  if (file_hash_p
+   && file_hash_p->m_size == length
+   && IFileManager::Get().FileSize(*file_path) == file_hash_p->m_size
+   && IFileManager::Get().GetTimeStamp(*file_path) == file_hash_p->m_time_stamp)
     {
-    UObjectPropertyBase * object_property_p = Cast<UObjectPropertyBase>(property_p);
-    m_used_classes.AddUnique(object_property_p->PropertyClass);
-    return skookify_class_name(object_property_p->PropertyClass->GetName());
+    has_changed = (file_hash_p->m_crc != new_crc);
+    }
+  else
+    {
+    has_changed = !is_file_equal(file_path, text_p, length);
     }
 
-  return ms_sk_type_id_names[type_id];
+  return has_changed;
   }
 
 //---------------------------------------------------------------------------------------
 
-uint32 FSkookumScriptGenerator::get_skookum_string_crc(const FString & string)
+void FSkookumScriptGenerator::record_file_hash(const FString & file_path, uint32 crc, int64 size)
   {
-  char buffer[256];
-  char * end_p = FPlatformString::Convert(buffer, sizeof(buffer), *string, string.Len());
-  return FCrc::MemCrc32(buffer, end_p - buffer);
+  // If a write failed, the old hash must not be replaced - the next run would take the stale file for up to date
+  FileHash & file_hash = m_file_hashes.FindOrAdd(file_path);
+  file_hash.m_crc = crc;
+  file_hash.m_size = size;
+  m_hashed_file_paths.Add(file_path);
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::get_cpp_class_name(UClass * class_p)
+bool FSkookumScriptGenerator::save_script_file(const FString & text, const FString & file_path)
   {
-  return FString::Printf(TEXT("%s%s"), class_p->GetPrefixCPP(), *class_p->GetName());
+  FString normalized_file_path(file_path);
+  FPaths::NormalizeFilename(normalized_file_path);
+  m_script_file_paths.Add(normalized_file_path);
+  if (m_write_signature_database)
+    {
+    add_signature(normalized_file_path, text);
+    }
+
+  // Leave unchanged files alone so the script compiler and IDE only pick up what actually changed
+  FTCHARToUTF8 text_utf8(*text, text.Len());
+  if (!m_update_scripts_in_place)
+    {
+    return save_utf8_file(text_utf8.Get(), text_utf8.Length(), file_path);
+    }
+  uint32 crc;
+  if (has_file_changed(file_path, text_utf8.Get(), text_utf8.Length(), &crc)
+   && !save_utf8_file(text_utf8.Get(), text_utf8.Length(), file_path))
+    {
+    return false;
+    }
+  record_file_hash(file_path, crc, text_utf8.Length());
+  return true;
   }
 
 //---------------------------------------------------------------------------------------
 
-FString FSkookumScriptGenerator::get_cpp_property_type_name(UProperty * property_p, uint32 port_flags /*= 0*/)
+void FSkookumScriptGenerator::delete_stale_script_files()
   {
-  static FString decl_Enum(TEXT("enum "));
-  static FString decl_Struct(TEXT("struct "));
-  static FString decl_Class(TEXT("class "));
-  static FString decl_TEnumAsByte(TEXT("TEnumAsByte<enum "));
-  static FString decl_TSubclassOf(TEXT("TSubclassOf<class "));
-  static FString decl_TSubclassOfShort(TEXT("TSubclassOf<"));
-
-  FString property_type_name = property_p->GetCPPType(NULL, port_flags);
-  // Strip any forward declaration keywords
-  if (property_type_name.StartsWith(decl_Enum) || property_type_name.StartsWith(decl_Struct) || property_type_name.StartsWith(decl_Class))
+  // Nothing stale when the folder was wiped at startup - and shards only know their own files, the merge step has them all
+  if (!m_update_scripts_in_place || m_shard_index >= 0)
     {
-    int first_space_index = property_type_name.Find(TEXT(" "));
-    property_type_name = property_type_name.Mid(first_space_index + 1);
+    return;
     }
-  else if (property_type_name.StartsWith(decl_TEnumAsByte))
+
+  const FString object_path = m_scripts_path / TEXT("Object");
+  TArray<FString> file_paths;
+  IFileManager::Get().FindFilesRecursive(file_paths, *object_path, TEXT("*"), true, false);
+  for (auto & file_path : file_paths)
     {
-    int first_space_index = property_type_name.Find(TEXT(" "));
-    property_type_name = TEXT("TEnumAsByte<") + property_type_name.Mid(first_space_index + 1);
+    FString normalized_file_path(file_path);
+    FPaths::NormalizeFilename(normalized_file_path);
+    if (!m_script_file_paths.Contains(normalized_file_path))
+      {
+      IFileManager::Get().Delete(*file_path, false, true);
+      }
     }
-  else if (property_type_name.StartsWith(decl_TSubclassOf)
-        || property_type_name.StartsWith(decl_TSubclassOfShort))
+
+  // Folders are classes to SkookumScript, so remove those left empty - innermost first as a non-empty folder won't be deleted
+  TArray<FString> directory_paths;
+  IFileManager::Get().FindFilesRecursive(directory_paths, *object_path, TEXT("*"), false, true);
+  directory_paths.Sort([](const FString & a, const FString & b) { return a.Len() > b.Len(); });
+  for (auto & directory_path : directory_paths)
     {
-    property_type_name = TEXT("UClass *");
+    IFileManager::Get().DeleteDirectory(*directory_path, false, false);
     }
-  return property_type_name;
   }
 
 //---------------------------------------------------------------------------------------
 
 bool FSkookumScriptGenerator::save_header_if_changed(const FString & header_path, const FString & new_header_contents)
   {
-  FString original_header_local;
-  FFileHelper::LoadFileToString(original_header_local, *header_path);
-
-  const bool has_changed = original_header_local.Len() == 0 || FCString::Strcmp(*original_header_local, *new_header_contents);
+  FTCHARToUTF8 new_header_utf8(*new_header_contents, new_header_contents.Len());
+  uint32 crc;
+  const bool has_changed = has_file_changed(header_path, new_header_utf8.Get(), new_header_utf8.Length(), &crc);
   if (has_changed)
     {
     // save the updated version to a tmp file so that the user can see what will be changing
@@ -1297,14 +4824,17 @@ bool FSkookumScriptGenerator::save_header_if_changed(const FString & header_path
 
     // delete any existing temp file
     IFileManager::Get().Delete(*temp_header_file_name, false, true);
-    if (!FFileHelper::SaveStringToFile(new_header_contents, *temp_header_file_name))
+    if (!save_utf8_file(new_header_utf8.Get(), new_header_utf8.Length(), temp_header_file_name))
       {
-      UE_LOG(LogSkookumScriptGenerator, Warning, TEXT("Failed to save header export: '%s'"), *temp_header_file_name);
-      }
-    else
-      {
-      m_temp_headers.Add(temp_header_file_name);
+      // Carrying on would leave the old header in place and compile stale bindings against the new scripts
+      FError::Throwf(TEXT("Failed to save header export: '%s'"), *temp_header_file_name);
       }
+    // Hash gets recorded once the header has been moved into place
+    m_temp_headers.Add({ header_path, crc, new_header_utf8.Length() });
+    }
+  else
+    {
+    record_file_hash(header_path, crc, new_header_utf8.Length());
     }
 
   return has_changed;
@@ -1315,18 +4845,18 @@ bool FSkookumScriptGenerator::save_header_if_changed(const FString & header_path
 void FSkookumScriptGenerator::rename_temp_files()
   {
   // Rename temp headers
-  for (auto & temp_header_file_name : m_temp_headers)
+  for (auto & temp_header : m_temp_headers)
     {
-    FString file_name = temp_header_file_name.Replace(TEXT(".tmp"), TEXT(""));
+    const FString & file_name = temp_header.m_file_path;
+    const FString temp_header_file_name = file_name + TEXT(".tmp");
     if (!IFileManager::Get().Move(*file_name, *temp_header_file_name, true, true))
       {
-      UE_LOG(LogSkookumScriptGenerator, Error, TEXT("%s"), *FString::Printf(TEXT("Couldn't write file '%s'"), *file_name));
-      }
-    else
-      {
-      UE_LOG(LogSkookumScriptGenerator, Log, TEXT("Exported updated script header: %s"), *file_name);
+      FError::Throwf(TEXT("Couldn't write file '%s'"), *file_name);
       }
+    record_file_hash(file_name, temp_header.m_crc, temp_header.m_size);
+    UE_LOG(LogSkookumScriptGenerator, Log, TEXT("Exported updated script header: %s"), *file_name);
     }
+  m_temp_headers.Reset();
   }
 
 //=======================================================================================
@@ -1339,6 +4869,7 @@ void FSkookumScriptGenerator::MethodBinding::make_method(UFunction * function_p)
   {
   m_script_name = skookify_method_name(function_p->GetName(), function_p->GetReturnProperty());
   m_code_name = m_script_name.Replace(TEXT("?"), TEXT("_Q"));
+  m_descriptor_index = -1;
   }
 
 //---------------------------------------------------------------------------------------
@@ -1347,6 +4878,7 @@ void FSkookumScriptGenerator::MethodBinding::make_property_getter(UProperty * pr
   {
   m_script_name = skookify_method_name(property_p->GetName(), property_p);
   m_code_name = m_script_name.Replace(TEXT("?"), TEXT("_Q"));
+  m_descriptor_index = -1;
   }
 
 //---------------------------------------------------------------------------------------
@@ -1355,4 +4887,42 @@ void FSkookumScriptGenerator::MethodBinding::make_property_setter(UProperty * pr
   {
   m_script_name = skookify_method_name(property_p->GetName()) + TEXT("_set");
   m_code_name = m_script_name;
+  m_descriptor_index = -1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::MethodBinding::make_event_method(UProperty * property_p, const TCHAR * suffix_p)
+  {
+  m_script_name = skookify_var_name(property_p->GetName()) + suffix_p;
+  m_code_name = m_script_name;
+  m_descriptor_index = -1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::MethodBinding::make_coroutine(UFunction * function_p)
+  {
+  m_code_name = skookify_method_name(function_p->GetName()).Replace(TEXT("?"), TEXT(""));
+  m_script_name = TEXT("_") + m_code_name;
+  m_descriptor_index = -1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::MethodBinding::make_snapshot(bool is_apply)
+  {
+  m_script_name = is_apply ? TEXT("apply_snapshot") : TEXT("snapshot");
+  m_code_name = m_script_name;
+  m_descriptor_index = -1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FSkookumScriptGenerator::MethodBinding::make_batch()
+  {
+  // Question mark is only allowed at the end of the name
+  m_script_name = m_script_name.Replace(TEXT("?"), TEXT("")) + TEXT("_batch");
+  m_code_name = m_script_name;
+  m_descriptor_index = -1;
   }